@@ -7,6 +7,26 @@
 #define pow2to63 9223372036854775808U
 #define pow2to56 72057594037927936U
 
+#if defined(__x86_64__) || defined(__i386__)
+#define BINARYFIELD_X86
+#include <immintrin.h>
+#endif
+
+/*
+* Reduces c3*z^192 + c2*z^128 + c1*z^64 + c0 mod f into r1*z^64 + r0 in registers.
+* With H = c div z^127 = h1*z^64 + h0 and z^127 = z^63 + 1, c = L + H + H*z^63,
+* and H*z^63 = (h0 + h1)*z^63 + h1 since h1*z^127 = h1*z^63 + h1.
+* The last step folds bit 127, which is only set when an operand had degree 127.
+*/
+#define FOLD_TRINOMIAL(c0, c1, c2, c3, r0, r1) do { \
+	uint64_t h0_ = ((c1) >> 63) | ((c2) << 1); \
+	uint64_t h1_ = ((c2) >> 63) | ((c3) << 1); \
+	uint64_t g_ = h0_ ^ h1_; \
+	uint64_t t_ = ((c1) & 0x7FFFFFFFFFFFFFFF) ^ h1_ ^ (g_ >> 1); \
+	(r0) = (c0) ^ g_ ^ (g_ << 63) ^ (t_ >> 63) ^ (t_ & pow2to63); \
+	(r1) = t_ & 0x7FFFFFFFFFFFFFFF; \
+} while(0)
+
 /* Reduction polynomial f(z) = z^127 + z^63 + 1 */
 uint64_t f[2] = {pow2to63+1, pow2to63};
 /* f(z) = z^127 + r(z) */
@@ -251,51 +271,27 @@ void mult_polynomial_lrcomb(uint64_t * a, uint64_t * b, uint64_t * c) {
 }
 
 /*
-* Alg 2.36 Left-to-right comb method for polynomial multiplication with window
-* Note that it does not reduce the result.
+* Builds the window table table[u] = u*b for all u of degree < w.
+* Each entry is built from an earlier one with a single shift or addition,
+* u*b = (u/2*b)*z for even u and u*b = (u-1)*b + b for odd u.
 * Preconditions:
-*   c is of length 4
-*   a,b are of max degree 126, length 2
-* 	w divides 64, for practical reasons < 32.
+*   table has 2^w entries
+*   b is of max degree 126, length 2, w <= 16
 */
-void mult_polynomial_lrcomb_window(uint64_t * a, uint64_t * b, uint64_t * c, int w) {
-	/* Step 1 */
+void window_table_precompute(uint64_t * b, int w, uint64_t (*table)[3]) {
 	uint64_t num_polynomials = 1ULL << w;
-	printf("num_polynomials: %" PRIu64 " \n", num_polynomials);
-	/* Product can't actually fill more than first 3 words, but need to conform to mult */
-	uint64_t bu[num_polynomials][4]; 
-	for(uint64_t i = 0; i < num_polynomials; i++) {
-		clear_array(bu[i], 4);
-		bu[i][0] = i;
-		/* This is faster method than lr, shift with B instead of C: */
-		mult_polynomial_rlcomb(b, bu[i], bu[i]); 
-	}
-	/* Step 2 */
-	clear_array(c, 4);
-	
-	/* Step 3 */
-	uint64_t digit_val = pow2to63;
-	for(int k = (64/w)-1; k >= 0; k--) {
-		/* Step 3.1 */
-		for(int j = 0; j < 2; j++) {
-			int u = 0;
-			uint64_t digit_val1 = digit_val;
-			for(int i = w - 1; i >= 0; i--) {
-				u <<= 1;
-				if((a[j] & digit_val1) == digit_val1) {
-					u++;
-				}
-				digit_val1 /= 2;
-			}
-			add_ext(bu[u], &c[j], &c[j], 3);
-		}
-		digit_val /= num_polynomials;
-		
-		/* Step 3.2 */
-		if(k != 0) { //TO BE OPTIMIZED, make generic n-shift w/ carry handling?
-			for(int i = 0; i < w; i++) {
-				lshift_polynomial(c, 4);
-			}
+	clear_array(table[0], 3);
+	table[1][0] = b[0];
+	table[1][1] = b[1];
+	table[1][2] = 0;
+	for(uint64_t i = 2; i < num_polynomials; i++) {
+		if(i % 2 == 0) {
+			uint64_t * half = table[i/2];
+			table[i][0] = half[0] << 1;
+			table[i][1] = (half[1] << 1) | (half[0] >> 63);
+			table[i][2] = (half[2] << 1) | (half[1] >> 63);
+		} else {
+			add_ext(table[i-1], table[1], table[i], 3);
 		}
 	}
 }
@@ -311,14 +307,10 @@ void mult_polynomial_lrcomb_window8(uint64_t * a, uint64_t * b, uint64_t * c) {
 	/* Step 1 */
 	uint64_t num_polynomials = 256;
 	
-	/* Product can't actually fill more than first 3 words, but need to conform to mult */
-	uint64_t bu[num_polynomials][4]; 
-	for(uint64_t i = 0; i < num_polynomials; i++) {
-		clear_array(bu[i], 4);
-		uint64_t u[2] = {i, 0};
-		/* This is faster method than lr, shift with B instead of C: */
-		mult_polynomial_rlcomb(u, b, bu[i]); 
-	}
+	/* Product can't fill more than first 3 words */
+	uint64_t bu[num_polynomials][3]; 
+	window_table_precompute(b, 8, bu);
+	
 	/* Step 2 */
 	clear_array(c, 4);
 	
@@ -355,606 +347,3082 @@ void mult_polynomial_lrcomb_window8(uint64_t * a, uint64_t * b, uint64_t * c) {
 	}
 }
 
-/* Karatsuba multiplication NOT DONE YET, also should think more about iterative approach*/
-int has_karatsuba_precomputed = 0;
-
-uint64_t karatsuba_polynomials[256];
-
-void karatsuba_precompute() {
-	uint64_t a[2] = {0,0};
-	uint64_t b[2] = {0,0};
-	uint64_t c[2] = {0,0};
-	
-	//only need half these calcs, commutative mult
-	for(a[0] = 0; a[0] < 16; a[0]++) {
-		for(b[0] = 0; b[0] < 16; b[0]++) {
-			c[0]=0;
-			mult_polynomial_rlcomb(a, b, c);
-			karatsuba_polynomials[a[0]*16+b[0]] = c[0];
-		}
+/*
+* Alg 2.36 Left-to-right comb with window width W, specialized at compile time.
+* Digit extraction is unrolled over both words of a and c is shifted W bits at
+* a time with the carry between words. When W does not divide 64 the top digit
+* of each word is simply shorter.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*/
+#define LRCOMB_W_PRODUCT(W, a, b, c0, c1, c2, c3) \
+	uint64_t bu[1 << W][3]; \
+	window_table_precompute(b, W, bu); \
+	uint64_t c0 = 0, c1 = 0, c2 = 0, c3 = 0; \
+	for(int k = ((64 + W - 1) / W - 1) * W; k >= 0; k -= W) { \
+		c3 = (c3 << W) | (c2 >> (64 - W)); \
+		c2 = (c2 << W) | (c1 >> (64 - W)); \
+		c1 = (c1 << W) | (c0 >> (64 - W)); \
+		c0 <<= W; \
+		uint64_t * u0 = bu[(a[0] >> k) & ((1 << W) - 1)]; \
+		uint64_t * u1 = bu[(a[1] >> k) & ((1 << W) - 1)]; \
+		c0 ^= u0[0]; \
+		c1 ^= u0[1] ^ u1[0]; \
+		c2 ^= u0[2] ^ u1[1]; \
+		c3 ^= u1[2]; \
 	}
-	has_karatsuba_precomputed = 1;
+
+#define DEFINE_MULT_POLYNOMIAL_LRCOMB_W(W) \
+void mult_polynomial_lrcomb_w##W(uint64_t * a, uint64_t * b, uint64_t * c) { \
+	LRCOMB_W_PRODUCT(W, a, b, c0, c1, c2, c3) \
+	c[0] = c0; \
+	c[1] = c1; \
+	c[2] = c2; \
+	c[3] = c3; \
 }
 
-void karatsuba_inner(uint64_t * a, uint64_t * b, uint64_t * c, int bitlen) {
-	if(bitlen == 4) {
-		c[0] = karatsuba_polynomials[a[0]*16 + b[0]];
-		c[1] = 0;
-		return;
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(2)
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(3)
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(4)
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(5)
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(6)
+DEFINE_MULT_POLYNOMIAL_LRCOMB_W(8)
+
+/*
+* Alg 2.36 Left-to-right comb method for polynomial multiplication with window
+* Uses the specialized version for w = 2, 3, 4, 5, 6 and 8. Any other width
+* outside 1..8 is rejected and the product is computed with w = 8, so the
+* table of at most 256 entries always fits on the stack.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+* 	1 <= w <= 8
+*/
+void mult_polynomial_lrcomb_window(uint64_t * a, uint64_t * b, uint64_t * c, int w) {
+	switch(w) {
+		case 1: case 7: break;
+		case 2: mult_polynomial_lrcomb_w2(a, b, c); return;
+		case 3: mult_polynomial_lrcomb_w3(a, b, c); return;
+		case 4: mult_polynomial_lrcomb_w4(a, b, c); return;
+		case 5: mult_polynomial_lrcomb_w5(a, b, c); return;
+		case 6: mult_polynomial_lrcomb_w6(a, b, c); return;
+		default: mult_polynomial_lrcomb_w8(a, b, c); return;
 	}
 	
-}
-
-void mult_karatsuba_recursive(uint64_t * a, uint64_t * b, uint64_t * c) {
-	if(!has_karatsuba_precomputed) {
-		karatsuba_precompute();
+	/* Step 1 */
+	uint64_t mask = (1ULL << w) - 1;
+	uint64_t bu[1 << 8][3];
+	window_table_precompute(b, w, bu);
+	
+	/* Step 2 */
+	clear_array(c, 4);
+	
+	/* Step 3 */
+	for(int k = ((64 + w - 1) / w - 1) * w; k >= 0; k -= w) {
+		/* Step 3.2, shift first so the last digit is not shifted */
+		c[3] = (c[3] << w) | (c[2] >> (64 - w));
+		c[2] = (c[2] << w) | (c[1] >> (64 - w));
+		c[1] = (c[1] << w) | (c[0] >> (64 - w));
+		c[0] <<= w;
+		/* Step 3.1 */
+		for(int j = 0; j < 2; j++) {
+			add_ext(bu[(a[j] >> k) & mask], &c[j], &c[j], 3);
+		}
 	}
-	karatsuba_inner(a, b, c, 128);
 }
 
+/* Multiplication by a prepared multiplicand, the window table is built once */
+
 /*
-* Alg 2.39 Polynomial squaring
+* Preconditions:
+*   b is of max degree 126, length 2
+*   w is 4 or 8
 */
-int has_square_precomputed = 0;
-
-uint16_t squaring_bytes[256];
-
-void squaring_precompute() {
-	for(int i = 0; i < 256; i++) {
-		for(int digit_val = 1; digit_val < 256; digit_val *= 2) {
-			if((i & digit_val) == digit_val) {
-				squaring_bytes[i] += digit_val*digit_val;
-			}
-		}
-	}
-	has_square_precomputed = 1;
+void prepare_multiplicand(uint64_t * b, int w, prepared_multiplicand_t * prepared) {
+	prepared->w = w;
+	window_table_precompute(b, w, prepared->table);
 }
 
 /*
+* Left-to-right comb over the prepared table, only the lookup/shift/add phase.
+* Note that it does not reduce the result.
 * Preconditions:
-* a has max degree 126, length 2
-* c has length 4
+*   c is of length 4
+*   a is of max degree 126, length 2
 */
-void square_polynomial(uint64_t * a, uint64_t * c) {
-	/* Step 1 */
-	if(!has_square_precomputed) {
-		squaring_precompute();
-	}
+void mult_polynomial_prepared(uint64_t * a, prepared_multiplicand_t * prepared, uint64_t * c) {
+	int w = prepared->w;
+	uint64_t mask = (1ULL << w) - 1;
+	clear_array(c, 4);
 	
-	/* Step 2 */
-	for(int i = 0; i < 2; i++) {
-		/* Step 2.1 */
-		uint8_t u[8];
-		uint64_t val_a = a[i];
+	for(int k = 64 - w; k >= 0; k -= w) {
+		uint64_t * u0 = prepared->table[(a[0] >> k) & mask];
+		uint64_t * u1 = prepared->table[(a[1] >> k) & mask];
+		c[0] ^= u0[0];
+		c[1] ^= u0[1] ^ u1[0];
+		c[2] ^= u0[2] ^ u1[1];
+		c[3] ^= u1[2];
 		
-		u[0] = val_a & 0xFF;
-		for(int j = 1; j < 8; j++) {
-			val_a >>= 8;
-			u[j] = val_a & 0xFF;
+		if(k != 0) {
+			c[3] = (c[3] << w) | (c[2] >> (64 - w));
+			c[2] = (c[2] << w) | (c[1] >> (64 - w));
+			c[1] = (c[1] << w) | (c[0] >> (64 - w));
+			c[0] <<= w;
 		}
-		
-		/* Step 2.2 */
-		c[2*i] = squaring_bytes[u[0]] | 
-			(uint64_t) squaring_bytes[u[1]] << 16 | 
-			(uint64_t) squaring_bytes[u[2]] << 32 |
-			(uint64_t) squaring_bytes[u[3]] << 48;
-		
-		c[2*i+1] = squaring_bytes[u[4]] | 
-			(uint64_t) squaring_bytes[u[5]] << 16 | 
-			(uint64_t) squaring_bytes[u[6]] << 32 |
-			(uint64_t) squaring_bytes[u[7]] << 48;
 	}
 }
 
-/* Alg 2.40 - Modular reduction (one bit at a time) */
+/* Portable carry-less multiplication with the integer multiplier */
 
-int has_reduction_precomputed = 0;
+/* Bit reversal of a word with masked swaps */
+uint64_t rev64(uint64_t x) {
+	x = ((x >> 1) & 0x5555555555555555) | ((x & 0x5555555555555555) << 1);
+	x = ((x >> 2) & 0x3333333333333333) | ((x & 0x3333333333333333) << 2);
+	x = ((x >> 4) & 0x0F0F0F0F0F0F0F0F) | ((x & 0x0F0F0F0F0F0F0F0F) << 4);
+	x = ((x >> 8) & 0x00FF00FF00FF00FF) | ((x & 0x00FF00FF00FF00FF) << 8);
+	x = ((x >> 16) & 0x0000FFFF0000FFFF) | ((x & 0x0000FFFF0000FFFF) << 16);
+	return (x >> 32) | (x << 32);
+}
 
-uint64_t reduction_polynomials[64][2];
+/*
+* Low 64 bits of the carry-less product x*y with integer multiplies.
+* The operands are split into the four classes of bits mod 4, so every
+* integer product puts its terms on one class and the three bits above
+* each term are holes for the carries. A bit position below 64 sums at
+* most 15 terms per product, so the carries never reach the next bit of
+* the same class, and masking keeps only the correct parities.
+*/
+uint64_t clmul64_holes_low(uint64_t x, uint64_t y) {
+	uint64_t m0 = 0x1111111111111111;
+	uint64_t m1 = 0x2222222222222222;
+	uint64_t m2 = 0x4444444444444444;
+	uint64_t m3 = 0x8888888888888888;
+	uint64_t x0 = x & m0, x1 = x & m1, x2 = x & m2, x3 = x & m3;
+	uint64_t y0 = y & m0, y1 = y & m1, y2 = y & m2, y3 = y & m3;
+	uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+	uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+	uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+	uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+	return (z0 & m0) | (z1 & m1) | (z2 & m2) | (z3 & m3);
+}
 
-void reduction_generic_precompute() {
-	reduction_polynomials[0][0] = r[0];
-	reduction_polynomials[0][1] = r[1];
-	for(int i = 1; i < 64; i++) {
-		reduction_polynomials[i][0] = reduction_polynomials[i-1][0];
-		reduction_polynomials[i][1] = reduction_polynomials[i-1][1];
-		lshift_polynomial(reduction_polynomials[i], 2);
-	}
-	
-	has_reduction_precomputed = 1;
+/*
+* Full 128-bit carry-less product x*y, c = {low, high}.
+* The high half is the low half of the product of the bit-reversed operands, reversed.
+*/
+void clmul64_holes(uint64_t x, uint64_t y, uint64_t * c) {
+	c[0] = clmul64_holes_low(x, y);
+	c[1] = rev64(clmul64_holes_low(rev64(x), rev64(y))) >> 1;
 }
 
 /*
- * Reduces c mod f, 
- * after which only the first 2 indices are guaranteed to be correct.
- * Precondition:
- * 	c has at most degree 2m-2
- *		c has length 4
- */
-void reduction_generic(uint64_t * c) {
-	/* Step 1 */
-	if(!has_reduction_precomputed) {
-		reduction_generic_precompute();
-	}
-	/* Step 2 */
-	uint64_t digit_val = pow2to63 / 8;
-	int index = 3;
-	for(int digit = 252; digit >= 127; digit--) {
-		/* Step 2.1 */
-		if((c[index] & digit_val) == digit_val) {
-			int j = (digit - 127)/64;
-			int k = (digit - 127) - 64*j;
-			add(reduction_polynomials[k], &c[j], &c[j]);
-		}
-		
-		if(digit % 64 == 0) {
-			digit_val = pow2to63;
-			index--;
-		} else {
-			digit_val /= 2;
-		}
-	}
-	//Algorithm in book is slightly wrong for some f, here is a general fix:
-	c[1] &= 0x7FFFFFFFFFFFFFFF;
-	c[2] = c[3] = 0;
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 127, length 2
+*/
+void mult_polynomial_holes(uint64_t * a, uint64_t * b, uint64_t * c) {
+	uint64_t lo[2];
+	uint64_t hi[2];
+	uint64_t mid[2];
+	clmul64_holes(a[0], b[0], lo);
+	clmul64_holes(a[1], b[1], hi);
+	clmul64_holes(a[0] ^ a[1], b[0] ^ b[1], mid);
+	mid[0] ^= lo[0] ^ hi[0];
+	mid[1] ^= lo[1] ^ hi[1];
+	c[0] = lo[0];
+	c[1] = lo[1] ^ mid[0];
+	c[2] = hi[0] ^ mid[1];
+	c[3] = hi[1];
 }
 
-/*  Alg 2.47 Extended Euclidean algorithm for binary polynomials */
+/* Carry-less multiplication with PCLMULQDQ */
+
+bool cpu_supports_pclmul() {
+#ifdef BINARYFIELD_X86
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("pclmul");
+#else
+	return 0;
+#endif
+}
+
+/* Single 64x64 product, c = {low, high} */
+#ifdef BINARYFIELD_X86
+#define TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+
+TARGET_PCLMUL
+void clmul64_pclmul(uint64_t x, uint64_t y, uint64_t * c) {
+	__m128i p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(x), _mm_cvtsi64_si128(y), 0x00);
+	_mm_storeu_si128((__m128i *) c, p);
+}
+#else
+#define TARGET_PCLMUL
+
+void clmul64_pclmul(uint64_t x, uint64_t y, uint64_t * c) {
+	clmul64_holes(x, y, c);
+}
+#endif
 
 /*
+* Karatsuba over the two 64-bit limbs, so 3 carry-less multiplies:
+* a*b = a1*b1*z^128 + ((a0+a1)*(b0+b1) + a0*b0 + a1*b1)*z^64 + a0*b0
+* Note that it does not reduce the result.
 * Preconditions:
-*	a has length 2
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*   cpu_supports_pclmul() is true
 */
-int degree_oldreference(uint64_t * a) {
-	int digit = 63;
-	uint64_t digit_val = pow2to63;
-	int j;
-	if(a[1] == 0) {
-		j = 0; 
+#ifdef BINARYFIELD_X86
+__attribute__((target("pclmul,sse2")))
+void mult_polynomial_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	__m128i va = _mm_loadu_si128((__m128i *) a);
+	__m128i vb = _mm_loadu_si128((__m128i *) b);
+	
+	/* a0*b0 and a1*b1 */
+	__m128i lo = _mm_clmulepi64_si128(va, vb, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(va, vb, 0x11);
+	
+	/* (a0+a1)*(b0+b1), the limbs are swapped with a shuffle before adding */
+	__m128i sa = _mm_xor_si128(va, _mm_shuffle_epi32(va, 0x4E));
+	__m128i sb = _mm_xor_si128(vb, _mm_shuffle_epi32(vb, 0x4E));
+	__m128i mid = _mm_clmulepi64_si128(sa, sb, 0x00);
+	mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+	
+	/* Middle term is shifted by 64 bits across lo and hi */
+	lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+	hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+	_mm_storeu_si128((__m128i *) c, lo);
+	_mm_storeu_si128((__m128i *) &c[2], hi);
+}
+#else
+void mult_polynomial_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	mult_polynomial_holes(a, b, c);
+}
+#endif
+
+/* Runtime dispatch, picks the kernel once on first use */
+int has_mult_dispatched = 0;
+
+void (*mult_polynomial_kernel)(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_dispatch() {
+	if(cpu_supports_pclmul()) {
+		mult_polynomial_kernel = mult_polynomial_clmul;
 	} else {
-		j = 1;
+		mult_polynomial_kernel = mult_polynomial_holes;
 	}
-	while(digit >= 0 && (a[j] & digit_val) == 0) {
-		digit--;
-		digit_val /= 2;
-	}
-	if(digit < 0) {
-		return 0;
-	} else {
-		return 64*j + digit;
+	has_mult_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*/
+void mult_polynomial(uint64_t * a, uint64_t * b, uint64_t * c) {
+	if(!has_mult_dispatched) {
+		mult_dispatch();
 	}
+	mult_polynomial_kernel(a, b, c);
 }
 
-int degree_len2(uint64_t * a) {
-	if(a[1] == 0) {
-		if(a[0] == 0) {
-			return 0;
-		}
-		int upper = a[0] >> 32;
-		if(upper == 0) {
-			return 31 - __builtin_clz(a[0]);
-		}
-		return 63 - __builtin_clz(upper);
+/* Sparse and monomial multiplication, cost scales with the number of terms */
+
+/*
+* c ^= a*z^k with word shifts, does not reduce.
+* Preconditions:
+*   a has length 2, max degree 126
+*   c has length 4
+*   k <= 127
+*/
+void add_shifted_polynomial(uint64_t * a, int k, uint64_t * c) {
+	int q = k / 64;
+	int s = k % 64;
+	if(s == 0) {
+		c[q] ^= a[0];
+		c[q+1] ^= a[1];
 	} else {
-		int upper = a[1] >> 32;
-		if(upper == 0) {
-			return 95 - __builtin_clz(a[1]);
-		}
-		return 127 - __builtin_clz(upper);
+		c[q] ^= a[0] << s;
+		c[q+1] ^= (a[1] << s) | (a[0] >> (64 - s));
+		c[q+2] ^= a[1] >> (64 - s);
 	}
 }
 
-int degree(uint64_t * a, int len) {
-	int degree = 0;
-	for(int i = len -1; i >= 0; i--) {
-		if(a[i] == 0) {
-			continue;
+/*
+* Up to this k the factor z^127 = z^63 + 1 is folded in 127 bits at a time,
+* above it the table is faster, measured with benchmark_mult_monomial.
+*/
+#define MONOMIAL_FOLD_MAX_K (6*127)
+
+int has_monomial_precomputed = 0;
+
+/* z^(d*64^i) mod f for every 6-bit digit d of k at each position i, 11 KiB */
+uint64_t monomial_table[11][64][2];
+
+void monomial_precompute() {
+	uint64_t z[2] = {2, 0};
+	for(int i = 0; i < 11; i++) {
+		monomial_table[i][0][0] = 1;
+		monomial_table[i][0][1] = 0;
+		monomial_table[i][1][0] = z[0];
+		monomial_table[i][1][1] = z[1];
+		for(int d = 2; d < 64; d++) {
+			field_mul(monomial_table[i][d - 1], z, monomial_table[i][d]);
 		}
-		int upper = a[i] >> 32;
-		if(upper == 0) {
-			return 31 + 64*i - __builtin_clz(a[i]);
+		/* z^(64^(i+1)) = (z^(64^i))^64 */
+		for(int j = 0; j < 6; j++) {
+			field_square(z, z);
 		}
-		return 63 + 64*i - __builtin_clz(upper);
 	}
+	has_monomial_precomputed = 1;
 }
 
 /*
-* Precondition:
-*	a and b have min length len
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
 */
-void swap_arrays(uint64_t * a, uint64_t * b, int len) {
-	for(int i = 0; i < len; i++) {
-		uint64_t temp = a[i];
-		a[i] = b[i];
-		b[i] = temp;
+void mult_monomial(uint64_t * a, uint64_t k, uint64_t * c) {
+	uint64_t t[2] = {a[0], a[1]};
+	uint64_t prod[4];
+	if(k <= MONOMIAL_FOLD_MAX_K) {
+		/* t*z^127 = t*z^63 + t, one shift and fold per 127 bits of k */
+		for(; k > 127; k -= 127) {
+			prod[0] = t[0];
+			prod[1] = t[1];
+			prod[2] = prod[3] = 0;
+			add_shifted_polynomial(t, 63, prod);
+			FOLD_TRINOMIAL(prod[0], prod[1], prod[2], prod[3], t[0], t[1]);
+		}
+		clear_array(prod, 4);
+		add_shifted_polynomial(t, k, prod);
+		FOLD_TRINOMIAL(prod[0], prod[1], prod[2], prod[3], c[0], c[1]);
+		return;
 	}
-}	
+	
+	if(!has_monomial_precomputed) {
+		monomial_precompute();
+	}
+	/* The lowest digit is a shift, each other nonzero digit one field_mul */
+	clear_array(prod, 4);
+	add_shifted_polynomial(t, k & 63, prod);
+	FOLD_TRINOMIAL(prod[0], prod[1], prod[2], prod[3], t[0], t[1]);
+	for(int i = 1; i < 11; i++) {
+		uint64_t d = (k >> (6*i)) & 63;
+		if(d != 0) {
+			field_mul(t, monomial_table[i][d], t);
+		}
+	}
+	c[0] = t[0];
+	c[1] = t[1];
+}
 
-void lshift_polynomial_optimized(uint64_t * a, int shift) {
-	if(shift == 0) {
-		return;
-	} else if(shift > 63) {
-		a[1] = a[0] << (shift - 64);
-		a[0] = 0;
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*   indices are unique and at most 127
+*/
+void mult_sparse(uint64_t * a, uint64_t * indices, int len_i, uint64_t * c) {
+	uint64_t prod[4] = {0, 0, 0, 0};
+	for(int i = 0; i < len_i; i++) {
+		add_shifted_polynomial(a, indices[i], prod);
+	}
+	FOLD_TRINOMIAL(prod[0], prod[1], prod[2], prod[3], c[0], c[1]);
+}
+
+/* Batched field multiplication of n independent pairs */
+
+bool cpu_supports_vpclmul() {
+#ifdef BINARYFIELD_X86
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512bw");
+#else
+	return 0;
+#endif
+}
+
+bool cpu_supports_vpclmul_avx2() {
+#ifdef BINARYFIELD_X86
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx2");
+#else
+	return 0;
+#endif
+}
+
+#ifdef BINARYFIELD_X86
+/*
+* Reduces the product lo = [c0, c1], hi = [c2, c3] mod f inside the register.
+* With H = c div z^127 = [h0, h1] and z^127 = z^63 + 1:
+* c = L + H + H*z^63, and H*z^63 = (h0 + h1)*z^63 + h1 since h1*z^127 = h1*z^63 + h1.
+* A last fold clears bit 127, which is only set when an operand had degree 127.
+*/
+__attribute__((target("pclmul,sse4.1")))
+__m128i reduce_clmul_product(__m128i lo, __m128i hi) {
+	__m128i mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFF, -1);
+	__m128i mid = _mm_alignr_epi8(hi, lo, 8); // [c1, c2]
+	__m128i h = _mm_or_si128(_mm_slli_epi64(hi, 1), _mm_srli_epi64(mid, 63));
+	__m128i g = _mm_xor_si128(h, _mm_shuffle_epi32(h, 0x4E));
+	__m128i x = _mm_unpacklo_epi64(_mm_slli_epi64(g, 63), _mm_srli_epi64(g, 1));
+	__m128i y = _mm_unpackhi_epi64(g, h);
+	__m128i res = _mm_xor_si128(_mm_and_si128(lo, mask), _mm_xor_si128(x, y));
+	__m128i t = _mm_srli_si128(_mm_srli_epi64(res, 63), 8);
+	res = _mm_xor_si128(res, _mm_xor_si128(t, _mm_slli_epi64(t, 63)));
+	return _mm_and_si128(res, mask);
+}
+
+/*
+* One PCLMULQDQ product at a time, reduced in registers.
+*/
+__attribute__((target("pclmul,sse4.1")))
+void mult_batch_pclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	for(uint64_t i = 0; i < n; i++) {
+		__m128i va = _mm_loadu_si128((__m128i *) &a[2*i]);
+		__m128i vb = _mm_loadu_si128((__m128i *) &b[2*i]);
+		__m128i lo = _mm_clmulepi64_si128(va, vb, 0x00);
+		__m128i hi = _mm_clmulepi64_si128(va, vb, 0x11);
+		__m128i sa = _mm_xor_si128(va, _mm_shuffle_epi32(va, 0x4E));
+		__m128i sb = _mm_xor_si128(vb, _mm_shuffle_epi32(vb, 0x4E));
+		__m128i mid = _mm_clmulepi64_si128(sa, sb, 0x00);
+		mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+		lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+		hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+		_mm_storeu_si128((__m128i *) &c[2*i], reduce_clmul_product(lo, hi));
+	}
+}
+
+/* reduce_clmul_product on the four 128-bit lanes of a 512-bit register */
+__attribute__((target("avx512f,avx512bw")))
+__m512i reduce_clmul_product_x4(__m512i lo, __m512i hi) {
+	__m512i mask = _mm512_set_epi64(0x7FFFFFFFFFFFFFFF, -1, 0x7FFFFFFFFFFFFFFF, -1,
+		0x7FFFFFFFFFFFFFFF, -1, 0x7FFFFFFFFFFFFFFF, -1);
+	__m512i mid = _mm512_alignr_epi8(hi, lo, 8);
+	__m512i h = _mm512_or_si512(_mm512_slli_epi64(hi, 1), _mm512_srli_epi64(mid, 63));
+	__m512i g = _mm512_xor_si512(h, _mm512_shuffle_epi32(h, _MM_PERM_BADC));
+	__m512i x = _mm512_unpacklo_epi64(_mm512_slli_epi64(g, 63), _mm512_srli_epi64(g, 1));
+	__m512i y = _mm512_unpackhi_epi64(g, h);
+	__m512i res = _mm512_xor_si512(_mm512_and_si512(lo, mask), _mm512_xor_si512(x, y));
+	__m512i t = _mm512_bsrli_epi128(_mm512_srli_epi64(res, 63), 8);
+	res = _mm512_xor_si512(res, _mm512_xor_si512(t, _mm512_slli_epi64(t, 63)));
+	return _mm512_and_si512(res, mask);
+}
+
+/*
+* Four products, one per 128-bit lane.
+* Same Karatsuba and reduction as the PCLMULQDQ version, lane by lane.
+*/
+__attribute__((target("avx512f,avx512bw,vpclmulqdq")))
+__m512i field_mul_x4(__m512i va, __m512i vb) {
+	__m512i lo = _mm512_clmulepi64_epi128(va, vb, 0x00);
+	__m512i hi = _mm512_clmulepi64_epi128(va, vb, 0x11);
+	__m512i sa = _mm512_xor_si512(va, _mm512_shuffle_epi32(va, _MM_PERM_BADC));
+	__m512i sb = _mm512_xor_si512(vb, _mm512_shuffle_epi32(vb, _MM_PERM_BADC));
+	__m512i mid = _mm512_clmulepi64_epi128(sa, sb, 0x00);
+	mid = _mm512_xor_si512(mid, _mm512_xor_si512(lo, hi));
+	lo = _mm512_xor_si512(lo, _mm512_bslli_epi128(mid, 8));
+	hi = _mm512_xor_si512(hi, _mm512_bsrli_epi128(mid, 8));
+	return reduce_clmul_product_x4(lo, hi);
+}
+
+/* Four squares, the square of each limb has no middle term */
+__attribute__((target("avx512f,avx512bw,vpclmulqdq")))
+__m512i field_square_x4(__m512i va) {
+	__m512i lo = _mm512_clmulepi64_epi128(va, va, 0x00);
+	__m512i hi = _mm512_clmulepi64_epi128(va, va, 0x11);
+	return reduce_clmul_product_x4(lo, hi);
+}
+
+/* The same lane kernels on 256-bit registers, VEX VPCLMULQDQ without AVX-512 */
+__attribute__((target("avx2")))
+__m256i reduce_clmul_product_x2(__m256i lo, __m256i hi) {
+	__m256i mask = _mm256_set_epi64x(0x7FFFFFFFFFFFFFFF, -1, 0x7FFFFFFFFFFFFFFF, -1);
+	__m256i mid = _mm256_alignr_epi8(hi, lo, 8);
+	__m256i h = _mm256_or_si256(_mm256_slli_epi64(hi, 1), _mm256_srli_epi64(mid, 63));
+	__m256i g = _mm256_xor_si256(h, _mm256_shuffle_epi32(h, 0x4E));
+	__m256i x = _mm256_unpacklo_epi64(_mm256_slli_epi64(g, 63), _mm256_srli_epi64(g, 1));
+	__m256i y = _mm256_unpackhi_epi64(g, h);
+	__m256i res = _mm256_xor_si256(_mm256_and_si256(lo, mask), _mm256_xor_si256(x, y));
+	__m256i t = _mm256_srli_si256(_mm256_srli_epi64(res, 63), 8);
+	res = _mm256_xor_si256(res, _mm256_xor_si256(t, _mm256_slli_epi64(t, 63)));
+	return _mm256_and_si256(res, mask);
+}
+
+__attribute__((target("avx2,vpclmulqdq")))
+__m256i field_mul_x2(__m256i va, __m256i vb) {
+	__m256i lo = _mm256_clmulepi64_epi128(va, vb, 0x00);
+	__m256i hi = _mm256_clmulepi64_epi128(va, vb, 0x11);
+	__m256i sa = _mm256_xor_si256(va, _mm256_shuffle_epi32(va, 0x4E));
+	__m256i sb = _mm256_xor_si256(vb, _mm256_shuffle_epi32(vb, 0x4E));
+	__m256i mid = _mm256_clmulepi64_epi128(sa, sb, 0x00);
+	mid = _mm256_xor_si256(mid, _mm256_xor_si256(lo, hi));
+	lo = _mm256_xor_si256(lo, _mm256_slli_si256(mid, 8));
+	hi = _mm256_xor_si256(hi, _mm256_srli_si256(mid, 8));
+	return reduce_clmul_product_x2(lo, hi);
+}
+
+__attribute__((target("avx2,vpclmulqdq")))
+__m256i field_square_x2(__m256i va) {
+	__m256i lo = _mm256_clmulepi64_epi128(va, va, 0x00);
+	__m256i hi = _mm256_clmulepi64_epi128(va, va, 0x11);
+	return reduce_clmul_product_x2(lo, hi);
+}
+
+/* Four elements per 512-bit register */
+__attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,sse4.1")))
+void mult_batch_vpclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	uint64_t i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m512i va = _mm512_loadu_si512((void *) &a[2*i]);
+		__m512i vb = _mm512_loadu_si512((void *) &b[2*i]);
+		_mm512_storeu_si512((void *) &c[2*i], field_mul_x4(va, vb));
+	}
+	mult_batch_pclmul(&a[2*i], &b[2*i], &c[2*i], n - i);
+}
+
+/* Two elements per 256-bit register */
+__attribute__((target("avx2,vpclmulqdq,pclmul,sse4.1")))
+void mult_batch_vpclmul_avx2(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	uint64_t i = 0;
+	for(; i + 2 <= n; i += 2) {
+		__m256i va = _mm256_loadu_si256((__m256i *) &a[2*i]);
+		__m256i vb = _mm256_loadu_si256((__m256i *) &b[2*i]);
+		_mm256_storeu_si256((__m256i *) &c[2*i], field_mul_x2(va, vb));
+	}
+	mult_batch_pclmul(&a[2*i], &b[2*i], &c[2*i], n - i);
+}
+#else
+void mult_batch_pclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	mult_batch_generic(a, b, c, n);
+}
+
+void mult_batch_vpclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	mult_batch_generic(a, b, c, n);
+}
+
+void mult_batch_vpclmul_avx2(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	mult_batch_generic(a, b, c, n);
+}
+#endif
+
+void mult_batch_generic(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	for(uint64_t i = 0; i < n; i++) {
+		field_mul(&a[2*i], &b[2*i], &c[2*i]);
+	}
+}
+
+int has_mult_batch_dispatched = 0;
+
+void (*mult_batch_kernel)(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+void mult_batch_dispatch() {
+	if(cpu_supports_vpclmul()) {
+		mult_batch_kernel = mult_batch_vpclmul;
+	} else if(cpu_supports_vpclmul_avx2()) {
+		mult_batch_kernel = mult_batch_vpclmul_avx2;
+	} else if(cpu_supports_pclmul()) {
+		mult_batch_kernel = mult_batch_pclmul;
 	} else {
-		uint64_t carry = a[0] >> (64 - shift);
-		a[0] <<= shift;
-		a[1] <<= shift;
-		a[1] |= carry;
+		mult_batch_kernel = mult_batch_generic;
 	}
+	has_mult_batch_dispatched = 1;
 }
 
 /*
-* Output is d = gcd(a,b), and g,h so that ag + bh = d
 * Preconditions:
-*	All arrays have length 2
-* 	0 < degree(a) <= degree(b)
+*   a, b, c have length 2n, element i is at index 2i
+*   elements of a, b have max degree 126
 */
-void extended_euclid(uint64_t * a, uint64_t * b, uint64_t * d, uint64_t * g, uint64_t * h) {
-	/* Step 1 */
-	uint64_t * u = malloc(2*sizeof(uint64_t));
-	uint64_t * v = malloc(2*sizeof(uint64_t));
-	memcpy(u, a, sizeof(uint64_t)*2);
-	memcpy(v, b, sizeof(uint64_t)*2);
-	//int deg_u = degree_len2(u);
-	int deg_u;
-	if(u[1] == 0) {
-		if(u[0] == 0) {
-			deg_u = 0;
-		} else {
-			int upper = u[0] >> 32;
-			if(upper == 0) {
-				deg_u = 31 - __builtin_clz(u[0]);
-			} else {
-				deg_u = 63 - __builtin_clz(upper);
-			}
-		}
-	} else {
-		int upper = u[1] >> 32;
-		if(upper == 0) {
-			deg_u = 95 - __builtin_clz(u[1]);
-		} else {
-			deg_u = 127 - __builtin_clz(upper);
-		}
+void mult_batch(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n) {
+	if(!has_mult_batch_dispatched) {
+		mult_batch_dispatch();
 	}
-	//int deg_v = degree_len2(v);
-	int deg_v;
-	if(v[1] == 0) {
-		if(v[0] == 0) {
-			deg_v = 0;
-		} else {
-			int upper = v[0] >> 32;
-			if(upper == 0) {
-				deg_v = 31 - __builtin_clz(v[0]);
-			} else {
-				deg_v = 63 - __builtin_clz(upper);
-			}
-		}
+	mult_batch_kernel(a, b, c, n);
+}
+
+/* Fused multiply-and-reduce, the product never leaves registers */
+
+#ifdef BINARYFIELD_X86
+__attribute__((target("pclmul,sse4.1")))
+void field_mul_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	__m128i va = _mm_loadu_si128((__m128i *) a);
+	__m128i vb = _mm_loadu_si128((__m128i *) b);
+	__m128i lo = _mm_clmulepi64_si128(va, vb, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(va, vb, 0x11);
+	__m128i sa = _mm_xor_si128(va, _mm_shuffle_epi32(va, 0x4E));
+	__m128i sb = _mm_xor_si128(vb, _mm_shuffle_epi32(vb, 0x4E));
+	__m128i mid = _mm_clmulepi64_si128(sa, sb, 0x00);
+	mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+	lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+	hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+	_mm_storeu_si128((__m128i *) c, reduce_clmul_product(lo, hi));
+}
+#else
+void field_mul_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	field_mul_software(a, b, c);
+}
+#endif
+
+/* Portable holes product into locals, then folded */
+void field_mul_software(uint64_t * a, uint64_t * b, uint64_t * c) {
+	uint64_t lo[2];
+	uint64_t hi[2];
+	uint64_t mid[2];
+	clmul64_holes(a[0], b[0], lo);
+	clmul64_holes(a[1], b[1], hi);
+	clmul64_holes(a[0] ^ a[1], b[0] ^ b[1], mid);
+	uint64_t c1 = lo[1] ^ mid[0] ^ lo[0] ^ hi[0];
+	uint64_t c2 = hi[0] ^ mid[1] ^ lo[1] ^ hi[1];
+	FOLD_TRINOMIAL(lo[0], c1, c2, hi[1], c[0], c[1]);
+}
+
+int has_field_mul_dispatched = 0;
+
+void (*field_mul_kernel)(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_mul_dispatch() {
+	if(cpu_supports_pclmul()) {
+		field_mul_kernel = field_mul_clmul;
 	} else {
-		int upper = v[1] >> 32;
-		if(upper == 0) {
-			deg_v = 95 - __builtin_clz(v[1]);
-		} else {
-			deg_v = 127 - __builtin_clz(upper);
-		}
+		field_mul_kernel = field_mul_software;
 	}
+	has_field_mul_dispatched = 1;
+}
 
-	/* Step 2 */ //Size might be wrong but my logic is that deg(u)-deg(v) is max 126, and original g1 can only feed from u-v so this is max degree
-	uint64_t * g1 = malloc(2*sizeof(uint64_t));
-	g1[0] = 1;
-	g1[1] = 0;
-	uint64_t * g2 = malloc(2*sizeof(uint64_t));
-	g2[0] = g2[1] = 0;
-	uint64_t * h1 = malloc(2*sizeof(uint64_t));
-	h1[0] = h1[1] = 0;
-	uint64_t * h2 = malloc(2*sizeof(uint64_t));
-	h2[0] = 1;
-	h2[1] = 0;
-	
-	/* Step 3 */
-	while (u[0] > 0 || u[1] > 0) {
-		/* Step 3.1 */
-		int j = deg_u - deg_v;
-		
-		/* Step 3.2 */
-		if(j < 0) {
-			uint64_t * tmp = u;
-			u = v;
-			v = tmp;
-			
-			tmp = g1;
-			g1 = g2;
-			g2 = tmp;
-			
-			tmp = h1;
-			h1 = h2;
-			h2 = tmp;
-			
-			j = -j;
-			
-			int temp8 = deg_u;
-			deg_u =  deg_v;
-			deg_v = temp8;
-		}
-		
-		/* Step 3.3 */
-		uint64_t shift_polynomial[2];
-		memcpy(shift_polynomial, v, sizeof(uint64_t)*2);
-		//lshift_polynomial_optimized(shift_polynomial, j);
-		if(j != 0) {
-			if(j > 63) {
-				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
-				shift_polynomial[0] = 0;
-			} else {
-				uint64_t carry = shift_polynomial[0] >> (64 - j);
-				shift_polynomial[0] <<= j;
-				shift_polynomial[1] <<= j;
-				shift_polynomial[1] |= carry;
-			}
-		}
-		//add(shift_polynomial, u, u);
-		u[0] = shift_polynomial[0] ^ u[0];
-		u[1] = shift_polynomial[1] ^ u[1];
-		//deg_u = degree_len2(u);
-		if(u[1] == 0) {
-			if(u[0] == 0) {
-				deg_u = 0;
-			} else {
-				int upper = u[0] >> 32;
-				if(upper == 0) {
-					deg_u = 31 - __builtin_clz(u[0]);
-				} else {
-					deg_u = 63 - __builtin_clz(upper);
-				}
-			}
-		} else {
-			int upper = u[1] >> 32;
-			if(upper == 0) {
-				deg_u = 95 - __builtin_clz(u[1]);
-			} else {
-				deg_u = 127 - __builtin_clz(upper);
-			}
-		}
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a,b are of max degree 127
+*/
+void field_mul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	if(!has_field_mul_dispatched) {
+		field_mul_dispatch();
+	}
+	field_mul_kernel(a, b, c);
+}
+
+/* Field squaring, the bit spreading is fused with the trinomial fold */
+
+bool cpu_supports_bmi2() {
+#ifdef BINARYFIELD_X86
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("bmi2");
+#else
+	return 0;
+#endif
+}
+
+bool cpu_supports_avx2() {
+#ifdef BINARYFIELD_X86
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	return 0;
+#endif
+}
+
+/* Spreads the low 32 bits of x to the even bit positions, masked shifts only */
+uint64_t spread_bits32(uint64_t x) {
+	x &= 0x00000000FFFFFFFF;
+	x = (x | (x << 16)) & 0x0000FFFF0000FFFF;
+	x = (x | (x << 8)) & 0x00FF00FF00FF00FF;
+	x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0F;
+	x = (x | (x << 2)) & 0x3333333333333333;
+	x = (x | (x << 1)) & 0x5555555555555555;
+	return x;
+}
+
+#ifdef BINARYFIELD_X86
+/* a0^2 and a1^2 are the whole square, there is no middle term */
+__attribute__((target("pclmul,sse4.1")))
+void field_square_clmul(uint64_t * a, uint64_t * c) {
+	__m128i va = _mm_loadu_si128((__m128i *) a);
+	__m128i lo = _mm_clmulepi64_si128(va, va, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(va, va, 0x11);
+	_mm_storeu_si128((__m128i *) c, reduce_clmul_product(lo, hi));
+}
+
+__attribute__((target("bmi2")))
+void field_square_pdep(uint64_t * a, uint64_t * c) {
+	uint64_t c0 = _pdep_u64(a[0], 0x5555555555555555);
+	uint64_t c1 = _pdep_u64(a[0] >> 32, 0x5555555555555555);
+	uint64_t c2 = _pdep_u64(a[1], 0x5555555555555555);
+	uint64_t c3 = _pdep_u64(a[1] >> 32, 0x5555555555555555);
+	FOLD_TRINOMIAL(c0, c1, c2, c3, c[0], c[1]);
+}
+
+/*
+* Two elements per 256-bit register, one per 128-bit lane.
+* PSHUFB looks up the spread of each nibble, unpacking the low and high nibble
+* results interleaves them into the 16-bit spread of each byte.
+* The reduction is the same as in mult_batch_vpclmul, lane by lane.
+*/
+__attribute__((target("avx2")))
+void field_square_array_avx2(uint64_t * a, uint64_t * c, uint64_t n) {
+	__m256i spread = _mm256_setr_epi8(0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15,
+		0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55,
+		0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15,
+		0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55);
+	__m256i nibble = _mm256_set1_epi8(0x0F);
+	__m256i mask = _mm256_set_epi64x(0x7FFFFFFFFFFFFFFF, -1, 0x7FFFFFFFFFFFFFFF, -1);
+	uint64_t i = 0;
+	for(; i + 2 <= n; i += 2) {
+		__m256i va = _mm256_loadu_si256((__m256i *) &a[2*i]);
 		
-		/*Step 3.4 */
-		memcpy(shift_polynomial, g2, sizeof(uint64_t)*2);
-		//lshift_polynomial_optimized(shift_polynomial, j);
-		if(j != 0) {
-			if(j > 63) {
-				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
-				shift_polynomial[0] = 0;
-			} else {
-				uint64_t carry = shift_polynomial[0] >> (64 - j);
-				shift_polynomial[0] <<= j;
-				shift_polynomial[1] <<= j;
-				shift_polynomial[1] |= carry;
-			}
-		}
-		//add(shift_polynomial, g1, g1);
-		g1[0] = shift_polynomial[0] ^ g1[0];
-		g1[1] = shift_polynomial[1] ^ g1[1];
+		/* Square */
+		__m256i sl = _mm256_shuffle_epi8(spread, _mm256_and_si256(va, nibble));
+		__m256i sh = _mm256_shuffle_epi8(spread, _mm256_and_si256(_mm256_srli_epi16(va, 4), nibble));
+		__m256i lo = _mm256_unpacklo_epi8(sl, sh);
+		__m256i hi = _mm256_unpackhi_epi8(sl, sh);
 		
-		memcpy(shift_polynomial, h2, sizeof(uint64_t)*2);
-		//lshift_polynomial_optimized(shift_polynomial, j);
-		if(j != 0) {
-			if(j > 63) {
-				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
-				shift_polynomial[0] = 0;
-			} else {
-				uint64_t carry = shift_polynomial[0] >> (64 - j);
-				shift_polynomial[0] <<= j;
-				shift_polynomial[1] <<= j;
-				shift_polynomial[1] |= carry;
-			}
-		}
-		//add(shift_polynomial, h1, h1);
-		h1[0] = shift_polynomial[0] ^ h1[0];
-		h1[1] = shift_polynomial[1] ^ h1[1];
+		/* Reduction */
+		__m256i mid = _mm256_alignr_epi8(hi, lo, 8);
+		__m256i h = _mm256_or_si256(_mm256_slli_epi64(hi, 1), _mm256_srli_epi64(mid, 63));
+		__m256i g = _mm256_xor_si256(h, _mm256_shuffle_epi32(h, 0x4E));
+		__m256i x = _mm256_unpacklo_epi64(_mm256_slli_epi64(g, 63), _mm256_srli_epi64(g, 1));
+		__m256i y = _mm256_unpackhi_epi64(g, h);
+		__m256i res = _mm256_xor_si256(_mm256_and_si256(lo, mask), _mm256_xor_si256(x, y));
+		__m256i t = _mm256_srli_si256(_mm256_srli_epi64(res, 63), 8);
+		res = _mm256_xor_si256(res, _mm256_xor_si256(t, _mm256_slli_epi64(t, 63)));
+		_mm256_storeu_si256((__m256i *) &c[2*i], _mm256_and_si256(res, mask));
 	}
-	/* Step 4 */
-	//swap_arrays(d, v, 2);
-	d[0] = v[0];
-	d[1] = v[1];
+	field_square_array_generic(&a[2*i], &c[2*i], n - i);
+}
+#else
+void field_square_clmul(uint64_t * a, uint64_t * c) {
+	field_square_software(a, c);
+}
+
+void field_square_pdep(uint64_t * a, uint64_t * c) {
+	field_square_software(a, c);
+}
+
+void field_square_array_avx2(uint64_t * a, uint64_t * c, uint64_t n) {
+	field_square_array_generic(a, c, n);
+}
+#endif
+
+void field_square_software(uint64_t * a, uint64_t * c) {
+	uint64_t c0 = spread_bits32(a[0]);
+	uint64_t c1 = spread_bits32(a[0] >> 32);
+	uint64_t c2 = spread_bits32(a[1]);
+	uint64_t c3 = spread_bits32(a[1] >> 32);
+	FOLD_TRINOMIAL(c0, c1, c2, c3, c[0], c[1]);
+}
+
+int has_field_square_dispatched = 0;
+
+void (*field_square_kernel)(uint64_t * a, uint64_t * c);
+
+void field_square_dispatch() {
+	if(cpu_supports_pclmul()) {
+		field_square_kernel = field_square_clmul;
+	} else if(cpu_supports_bmi2()) {
+		field_square_kernel = field_square_pdep;
+	} else {
+		field_square_kernel = field_square_software;
+	}
+	has_field_square_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void field_square(uint64_t * a, uint64_t * c) {
+	if(!has_field_square_dispatched) {
+		field_square_dispatch();
+	}
+	field_square_kernel(a, c);
+}
+
+void field_square_array_generic(uint64_t * a, uint64_t * c, uint64_t n) {
+	for(uint64_t i = 0; i < n; i++) {
+		field_square(&a[2*i], &c[2*i]);
+	}
+}
+
+int has_field_square_array_dispatched = 0;
+
+void (*field_square_array_kernel)(uint64_t * a, uint64_t * c, uint64_t n);
+
+void field_square_array_dispatch() {
+	if(cpu_supports_avx2()) {
+		field_square_array_kernel = field_square_array_avx2;
+	} else {
+		field_square_array_kernel = field_square_array_generic;
+	}
+	has_field_square_array_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   a, c have length 2n, element i is at index 2i
+*   elements of a have max degree 127
+*/
+void field_square_array(uint64_t * a, uint64_t * c, uint64_t n) {
+	if(!has_field_square_array_dispatched) {
+		field_square_array_dispatch();
+	}
+	field_square_array_kernel(a, c, n);
+}
+
+/* Multi-squaring a^(2^k), a GF(2)-linear map applied with byte-indexed tables */
+
+/*
+* Below this k the iterated field_square is faster than the 16 table lookups,
+* measured with benchmark_field_multisquare.
+*/
+#define MULTISQUARE_TABLE_MIN_K 4
+
+int has_multisquare_precomputed[127] = {0};
+
+/*
+* Table for each k, the image of every byte value at each of the 16 byte
+* positions, 64 KiB per k. The table of a k is built on its first use, so
+* only the pages of the k in use are ever touched.
+*/
+uint64_t multisquare_tables[127][16][256][2];
+
+void field_multisquare_iterated(uint64_t * a, uint64_t k, uint64_t * c) {
+	c[0] = a[0];
+	c[1] = a[1];
+	for(uint64_t i = 0; i < k; i++) {
+		field_square(c, c);
+	}
+}
+
+/*
+* Byte tables of a GF(2)-linear map given by the images basis[i] of z^i.
+* Fills table[j][v] with the image of v*z^(8j), one XOR per entry
+* from the entry with the lowest bit of v cleared.
+*/
+void linear_map_precompute(uint64_t (*basis)[2], uint64_t (*table)[256][2]) {
+	for(int j = 0; j < 16; j++) {
+		table[j][0][0] = table[j][0][1] = 0;
+		for(int v = 1; v < 256; v++) {
+			int low = __builtin_ctz(v);
+			table[j][v][0] = table[j][v & (v - 1)][0] ^ basis[8*j + low][0];
+			table[j][v][1] = table[j][v & (v - 1)][1] ^ basis[8*j + low][1];
+		}
+	}
+}
+
+/* The linear map of linear_map_precompute applied to a, 16 lookups */
+void linear_map_apply(uint64_t (*table)[256][2], uint64_t * a, uint64_t * c) {
+	uint64_t c0 = 0;
+	uint64_t c1 = 0;
+	for(int j = 0; j < 16; j++) {
+		uint8_t v = a[j / 8] >> (8*(j % 8));
+		c0 ^= table[j][v][0];
+		c1 ^= table[j][v][1];
+	}
+	c[0] = c0;
+	c[1] = c1;
+}
+
+void multisquare_precompute(uint64_t k, uint64_t (*table)[256][2]) {
+	uint64_t basis[128][2];
+	for(int i = 0; i < 128; i++) {
+		uint64_t monomial[2] = {1, 0};
+		mult_monomial(monomial, i, monomial);
+		field_multisquare_iterated(monomial, k, basis[i]);
+	}
+	linear_map_precompute(basis, table);
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void field_multisquare_table(uint64_t * a, uint64_t k, uint64_t * c) {
+	k %= 127;
+	if(!has_multisquare_precomputed[k]) {
+		multisquare_precompute(k, multisquare_tables[k]);
+		has_multisquare_precomputed[k] = 1;
+	}
+	linear_map_apply(multisquare_tables[k], a, c);
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void field_multisquare(uint64_t * a, uint64_t k, uint64_t * c) {
+	/* a^(2^127) = a in GF(2^127) */
+	k %= 127;
+	if(k < MULTISQUARE_TABLE_MIN_K) {
+		field_multisquare_iterated(a, k, c);
+	} else {
+		field_multisquare_table(a, k, c);
+	}
+}
+
+/* Square root, sqrt(a) = even(a) + sqrt(z)*odd(a) with sqrt(z) = z^64 + z^32 */
+
+/* Gathers the even bits of x into the low 32 bits, masked shifts only */
+uint64_t compact_bits32(uint64_t x) {
+	x &= 0x5555555555555555;
+	x = (x | (x >> 1)) & 0x3333333333333333;
+	x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0F;
+	x = (x | (x >> 4)) & 0x00FF00FF00FF00FF;
+	x = (x | (x >> 8)) & 0x0000FFFF0000FFFF;
+	x = (x | (x >> 16)) & 0x00000000FFFFFFFF;
+	return x;
+}
+
+/*
+* (z^64 + z^32)^2 = z^128 + z^64 = z*(z^63 + 1) + z^64 = z.
+* odd(a) has max degree 62, so odd(a)*(z^64 + z^32) has max degree 126
+* and the sum needs no reduction.
+*/
+#define SQRT_FROM_HALVES(e, o, c) do { \
+	(c)[0] = (e) ^ ((o) << 32); \
+	(c)[1] = ((o) >> 32) ^ (o); \
+} while(0)
+
+#ifdef BINARYFIELD_X86
+__attribute__((target("bmi2")))
+void field_sqrt_pext(uint64_t * a, uint64_t * c) {
+	uint64_t e = _pext_u64(a[0], 0x5555555555555555) | (_pext_u64(a[1], 0x5555555555555555) << 32);
+	uint64_t o = _pext_u64(a[0], 0xAAAAAAAAAAAAAAAA) | (_pext_u64(a[1], 0xAAAAAAAAAAAAAAAA) << 32);
+	SQRT_FROM_HALVES(e, o, c);
+}
+#else
+void field_sqrt_pext(uint64_t * a, uint64_t * c) {
+	field_sqrt_software(a, c);
+}
+#endif
+
+void field_sqrt_software(uint64_t * a, uint64_t * c) {
+	uint64_t e = compact_bits32(a[0]) | (compact_bits32(a[1]) << 32);
+	uint64_t o = compact_bits32(a[0] >> 1) | (compact_bits32(a[1] >> 1) << 32);
+	SQRT_FROM_HALVES(e, o, c);
+}
+
+int has_field_sqrt_dispatched = 0;
+
+void (*field_sqrt_kernel)(uint64_t * a, uint64_t * c);
+
+void field_sqrt_dispatch() {
+	if(cpu_supports_bmi2()) {
+		field_sqrt_kernel = field_sqrt_pext;
+	} else {
+		field_sqrt_kernel = field_sqrt_software;
+	}
+	has_field_sqrt_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void field_sqrt(uint64_t * a, uint64_t * c) {
+	if(!has_field_sqrt_dispatched) {
+		field_sqrt_dispatch();
+	}
+	field_sqrt_kernel(a, c);
+}
+
+/* Redundant representation, elements of max degree 127 congruent mod f */
+
+/*
+* Reduces c3*z^192 + c2*z^128 + c1*z^64 + c0 to max degree 127 in registers, with
+* z^128 = z^64 + z. The first fold leaves c3*z^128, c3 has max degree 62
+* so the second fold ends below z^128. With g = c2 + c3:
+* r = c0 + c1*z^64 + g*z^64 + g*z + c3*z^65.
+*/
+#define FOLD_LAZY(c0, c1, c2, c3, r0, r1) do { \
+	uint64_t g_ = (c2) ^ (c3); \
+	(r0) = (c0) ^ (g_ << 1); \
+	(r1) = (c1) ^ g_ ^ (g_ >> 63) ^ ((c3) << 1); \
+} while(0)
+
+#ifdef BINARYFIELD_X86
+/* FOLD_LAZY inside the register, lo = [c0, c1], hi = [c2, c3] */
+__attribute__((target("pclmul,sse4.1")))
+__m128i fold_lazy_clmul_product(__m128i lo, __m128i hi) {
+	__m128i g = _mm_xor_si128(hi, _mm_srli_si128(hi, 8)); // [c2 + c3, c3]
+	__m128i x = _mm_slli_epi64(g, 1);
+	__m128i y = _mm_slli_si128(_mm_xor_si128(g, _mm_srli_epi64(g, 63)), 8);
+	return _mm_xor_si128(lo, _mm_xor_si128(x, y));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+void field_mul_lazy_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	__m128i va = _mm_loadu_si128((__m128i *) a);
+	__m128i vb = _mm_loadu_si128((__m128i *) b);
+	__m128i lo = _mm_clmulepi64_si128(va, vb, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(va, vb, 0x11);
+	__m128i sa = _mm_xor_si128(va, _mm_shuffle_epi32(va, 0x4E));
+	__m128i sb = _mm_xor_si128(vb, _mm_shuffle_epi32(vb, 0x4E));
+	__m128i mid = _mm_clmulepi64_si128(sa, sb, 0x00);
+	mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+	lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+	hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+	_mm_storeu_si128((__m128i *) c, fold_lazy_clmul_product(lo, hi));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+void field_square_lazy_clmul(uint64_t * a, uint64_t * c) {
+	__m128i va = _mm_loadu_si128((__m128i *) a);
+	__m128i lo = _mm_clmulepi64_si128(va, va, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(va, va, 0x11);
+	_mm_storeu_si128((__m128i *) c, fold_lazy_clmul_product(lo, hi));
+}
+#else
+void field_mul_lazy_clmul(uint64_t * a, uint64_t * b, uint64_t * c) {
+	field_mul_lazy_software(a, b, c);
+}
+
+void field_square_lazy_clmul(uint64_t * a, uint64_t * c) {
+	field_square_lazy_software(a, c);
+}
+#endif
+
+void field_mul_lazy_software(uint64_t * a, uint64_t * b, uint64_t * c) {
+	uint64_t lo[2];
+	uint64_t hi[2];
+	uint64_t mid[2];
+	clmul64_holes(a[0], b[0], lo);
+	clmul64_holes(a[1], b[1], hi);
+	clmul64_holes(a[0] ^ a[1], b[0] ^ b[1], mid);
+	uint64_t c1 = lo[1] ^ mid[0] ^ lo[0] ^ hi[0];
+	uint64_t c2 = hi[0] ^ mid[1] ^ lo[1] ^ hi[1];
+	FOLD_LAZY(lo[0], c1, c2, hi[1], c[0], c[1]);
+}
+
+void field_square_lazy_software(uint64_t * a, uint64_t * c) {
+	uint64_t c0 = spread_bits32(a[0]);
+	uint64_t c1 = spread_bits32(a[0] >> 32);
+	uint64_t c2 = spread_bits32(a[1]);
+	uint64_t c3 = spread_bits32(a[1] >> 32);
+	FOLD_LAZY(c0, c1, c2, c3, c[0], c[1]);
+}
+
+int has_field_lazy_dispatched = 0;
+
+void (*field_mul_lazy_kernel)(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void (*field_square_lazy_kernel)(uint64_t * a, uint64_t * c);
+
+void field_lazy_dispatch() {
+	if(cpu_supports_pclmul()) {
+		field_mul_lazy_kernel = field_mul_lazy_clmul;
+		field_square_lazy_kernel = field_square_lazy_clmul;
+	} else {
+		field_mul_lazy_kernel = field_mul_lazy_software;
+		field_square_lazy_kernel = field_square_lazy_software;
+	}
+	has_field_lazy_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a,b are of max degree 127
+*/
+void field_mul_lazy(uint64_t * a, uint64_t * b, uint64_t * c) {
+	if(!has_field_lazy_dispatched) {
+		field_lazy_dispatch();
+	}
+	field_mul_lazy_kernel(a, b, c);
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void field_square_lazy(uint64_t * a, uint64_t * c) {
+	if(!has_field_lazy_dispatched) {
+		field_lazy_dispatch();
+	}
+	field_square_lazy_kernel(a, c);
+}
+
+/* Folds bit 127 with z^127 = z^63 + 1, branch-free */
+void field_canonicalize(uint64_t * a, uint64_t * c) {
+	uint64_t t = a[1] >> 63;
+	c[0] = a[0] ^ t ^ (t << 63);
+	c[1] = a[1] & 0x7FFFFFFFFFFFFFFF;
+}
+
+bool field_equal(uint64_t * a, uint64_t * b) {
+	uint64_t ca[2];
+	uint64_t cb[2];
+	field_canonicalize(a, ca);
+	field_canonicalize(b, cb);
+	return equal_polynomials(ca, cb, 2);
+}
+
+/* Lazy reduction, sums of unreduced products are reduced once */
+
+void accumulator_init(accumulator_t * acc) {
+	clear_array(acc->c, 4);
+}
+
+/*
+* Preconditions:
+*   a,b are of max degree 126, length 2
+*/
+void accumulator_mult_add(accumulator_t * acc, uint64_t * a, uint64_t * b) {
+	uint64_t prod[4];
+	mult_polynomial(a, b, prod);
+	add_ext(prod, acc->c, acc->c, 4);
+}
+
+/*
+* Preconditions:
+*   c has length 2
+*/
+void accumulator_finalize(accumulator_t * acc, uint64_t * c) {
+	uint64_t sum[4];
+	memcpy(sum, acc->c, sizeof(uint64_t)*4);
+	reduction_trinomial(sum);
+	c[0] = sum[0];
+	c[1] = sum[1];
+}
+
+/*
+* Preconditions:
+*   a, b have length 2n, element i is at index 2i
+*   c has length 2
+*/
+void inner_product(uint64_t * a, uint64_t * b, uint64_t n, uint64_t * c) {
+	accumulator_t acc;
+	accumulator_init(&acc);
+	for(uint64_t i = 0; i < n; i++) {
+		accumulator_mult_add(&acc, &a[2*i], &b[2*i]);
+	}
+	accumulator_finalize(&acc, c);
+}
+
+/* Bitsliced multiplication of 64 independent pairs */
+
+/*
+* Transposes the 64x64 bit matrix m in place, bit j of m[i] becomes bit i of m[j].
+* Swaps blocks of halving size, 6 rounds of 32 word operations.
+*/
+void bitslice_transpose64(uint64_t * m) {
+	uint64_t mask = 0x00000000FFFFFFFF;
+	for(int j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+		for(int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			uint64_t t = ((m[k] >> j) ^ m[k | j]) & mask;
+			m[k] ^= t << j;
+			m[k | j] ^= t;
+		}
+	}
+}
+
+/*
+* 64 elements to 128 bit-planes, bit i of planes[k] is coefficient k of element i.
+* Preconditions:
+*   a has length 128, element i is at index 2i
+*   planes has length 128
+*/
+void bitslice_to_planes(uint64_t * a, uint64_t * planes) {
+	for(int w = 0; w < 2; w++) {
+		for(int i = 0; i < 64; i++) {
+			planes[64*w + i] = a[2*i + w];
+		}
+		bitslice_transpose64(&planes[64*w]);
+	}
+}
+
+/* Inverse of bitslice_to_planes, planes is used as scratch */
+void bitslice_from_planes(uint64_t * planes, uint64_t * a) {
+	for(int w = 0; w < 2; w++) {
+		bitslice_transpose64(&planes[64*w]);
+		for(int i = 0; i < 64; i++) {
+			a[2*i + w] = planes[64*w + i];
+		}
+	}
+}
+
+/* Schoolbook product of two 64-plane polynomials into 127 planes */
+void bitslice_mult64(uint64_t * x, uint64_t * y, uint64_t * p) {
+	clear_array(p, 127);
+	for(int i = 0; i < 64; i++) {
+		for(int j = 0; j < 64; j++) {
+			p[i + j] ^= x[i] & y[j];
+		}
+	}
+}
+
+/*
+* Preconditions:
+*   a, b, c have length 128, element i is at index 2i
+*   elements of a, b have max degree 126
+*/
+void mult_bitsliced64(uint64_t * a, uint64_t * b, uint64_t * c) {
+	/* Step 1, transpose */
+	uint64_t pa[128];
+	uint64_t pb[128];
+	bitslice_to_planes(a, pa);
+	bitslice_to_planes(b, pb);
+	
+	/* Step 2, one level of Karatsuba on the plane halves */
+	uint64_t sa[64];
+	uint64_t sb[64];
+	for(int i = 0; i < 64; i++) {
+		sa[i] = pa[i] ^ pa[64 + i];
+		sb[i] = pb[i] ^ pb[64 + i];
+	}
+	uint64_t lo[127];
+	uint64_t hi[127];
+	uint64_t mid[127];
+	bitslice_mult64(pa, pb, lo);
+	bitslice_mult64(&pa[64], &pb[64], hi);
+	bitslice_mult64(sa, sb, mid);
+	
+	uint64_t p[255];
+	clear_array(p, 255);
+	for(int i = 0; i < 127; i++) {
+		p[i] ^= lo[i];
+		p[i + 64] ^= mid[i] ^ lo[i] ^ hi[i];
+		p[i + 128] ^= hi[i];
+	}
+	
+	/* Step 3, reduction with z^k = z^(k-64) + z^(k-127) for k >= 127, top down */
+	for(int k = 254; k >= 127; k--) {
+		p[k - 64] ^= p[k];
+		p[k - 127] ^= p[k];
+	}
+	p[127] = 0;
+	
+	/* Step 4, transpose back */
+	bitslice_from_planes(p, c);
+}
+
+/* Karatsuba multiplication, iterative over the levels of the Karatsuba tree */
+int has_karatsuba_precomputed = 0;
+
+/* 4x4 bit products, index a*16 + b */
+uint64_t karatsuba_polynomials[256];
+
+/* 8x8 bit products used at the leaves, index a*256 + b */
+uint16_t karatsuba_bytes[65536];
+
+void karatsuba_precompute() {
+	uint64_t a[2] = {0,0};
+	uint64_t b[2] = {0,0};
+	uint64_t c[4] = {0,0,0,0};
+	
+	//only need half these calcs, commutative mult
+	for(a[0] = 0; a[0] < 16; a[0]++) {
+		for(b[0] = 0; b[0] < 16; b[0]++) {
+			mult_polynomial_rlcomb(a, b, c);
+			karatsuba_polynomials[a[0]*16+b[0]] = c[0];
+		}
+	}
+	
+	/* 8x8 from four 4x4 products: (ah*z^4 + al)*(bh*z^4 + bl) */
+	for(int i = 0; i < 256; i++) {
+		for(int j = 0; j < 256; j++) {
+			uint64_t ll = karatsuba_polynomials[(i & 15)*16 + (j & 15)];
+			uint64_t hh = karatsuba_polynomials[(i >> 4)*16 + (j >> 4)];
+			uint64_t lh = karatsuba_polynomials[(i & 15)*16 + (j >> 4)] 
+				^ karatsuba_polynomials[(i >> 4)*16 + (j & 15)];
+			karatsuba_bytes[i*256 + j] = ll ^ (lh << 4) ^ (hh << 8);
+		}
+	}
+	has_karatsuba_precomputed = 1;
+}
+
+/*
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*/
+void mult_karatsuba(uint64_t * a, uint64_t * b, uint64_t * c) {
+	/* Step 1 */
+	if(!has_karatsuba_precomputed) {
+		karatsuba_precompute();
+	}
+	
+	/* Step 2, split top-down. Level l has 3^l operand pairs of 128/2^l bits,
+	 * node i of a level has children 3i (low halves), 3i+1 (high halves), 3i+2 (sums) */
+	uint64_t split_a[3 + 9 + 27 + 81];
+	uint64_t split_b[3 + 9 + 27 + 81];
+	split_a[0] = a[0];
+	split_a[1] = a[1];
+	split_a[2] = a[0] ^ a[1];
+	split_b[0] = b[0];
+	split_b[1] = b[1];
+	split_b[2] = b[0] ^ b[1];
+	
+	int parent = 0;
+	int child = 3;
+	int nodes = 3;
+	for(int bits = 32; bits >= 8; bits /= 2) {
+		uint64_t mask = (1ULL << bits) - 1;
+		for(int i = 0; i < nodes; i++) {
+			split_a[child + 3*i] = split_a[parent + i] & mask;
+			split_a[child + 3*i + 1] = split_a[parent + i] >> bits;
+			split_a[child + 3*i + 2] = split_a[child + 3*i] ^ split_a[child + 3*i + 1];
+			split_b[child + 3*i] = split_b[parent + i] & mask;
+			split_b[child + 3*i + 1] = split_b[parent + i] >> bits;
+			split_b[child + 3*i + 2] = split_b[child + 3*i] ^ split_b[child + 3*i + 1];
+		}
+		parent = child;
+		child += 3*nodes;
+		nodes *= 3;
+	}
+	
+	/* Step 3, the 81 leaves are 8x8 table lookups */
+	uint64_t prod[81];
+	for(int i = 0; i < nodes; i++) {
+		prod[i] = karatsuba_bytes[split_a[parent + i]*256 + split_b[parent + i]];
+	}
+	
+	/* Step 4, combine bottom-up, in place. Products of up to 32-bit operands fit a word */
+	for(int bits = 8; bits <= 16; bits *= 2) {
+		nodes /= 3;
+		for(int i = 0; i < nodes; i++) {
+			uint64_t lo = prod[3*i];
+			uint64_t hi = prod[3*i + 1];
+			uint64_t mid = prod[3*i + 2] ^ lo ^ hi;
+			prod[i] = lo ^ (mid << bits) ^ (hi << 2*bits);
+		}
+	}
+	
+	/* Step 5, 64x64 products need two words */
+	uint64_t prod64[3][2];
+	for(int i = 0; i < 3; i++) {
+		uint64_t lo = prod[3*i];
+		uint64_t hi = prod[3*i + 1];
+		uint64_t mid = prod[3*i + 2] ^ lo ^ hi;
+		prod64[i][0] = lo ^ (mid << 32);
+		prod64[i][1] = hi ^ (mid >> 32);
+	}
+	
+	/* Step 6, root */
+	uint64_t mid0 = prod64[2][0] ^ prod64[0][0] ^ prod64[1][0];
+	uint64_t mid1 = prod64[2][1] ^ prod64[0][1] ^ prod64[1][1];
+	c[0] = prod64[0][0];
+	c[1] = prod64[0][1] ^ mid0;
+	c[2] = prod64[1][0] ^ mid1;
+	c[3] = prod64[1][1];
+}
+
+/*
+* Alg 2.39 Polynomial squaring
+*/
+int has_square_precomputed = 0;
+
+uint16_t squaring_bytes[256];
+
+void squaring_precompute() {
+	for(int i = 0; i < 256; i++) {
+		for(int digit_val = 1; digit_val < 256; digit_val *= 2) {
+			if((i & digit_val) == digit_val) {
+				squaring_bytes[i] += digit_val*digit_val;
+			}
+		}
+	}
+	has_square_precomputed = 1;
+}
+
+/*
+* Preconditions:
+* a has max degree 126, length 2
+* c has length 4
+*/
+void square_polynomial(uint64_t * a, uint64_t * c) {
+	/* Step 1 */
+	if(!has_square_precomputed) {
+		squaring_precompute();
+	}
+	
+	/* Step 2 */
+	for(int i = 0; i < 2; i++) {
+		/* Step 2.1 */
+		uint8_t u[8];
+		uint64_t val_a = a[i];
+		
+		u[0] = val_a & 0xFF;
+		for(int j = 1; j < 8; j++) {
+			val_a >>= 8;
+			u[j] = val_a & 0xFF;
+		}
+		
+		/* Step 2.2 */
+		c[2*i] = squaring_bytes[u[0]] | 
+			(uint64_t) squaring_bytes[u[1]] << 16 | 
+			(uint64_t) squaring_bytes[u[2]] << 32 |
+			(uint64_t) squaring_bytes[u[3]] << 48;
+		
+		c[2*i+1] = squaring_bytes[u[4]] | 
+			(uint64_t) squaring_bytes[u[5]] << 16 | 
+			(uint64_t) squaring_bytes[u[6]] << 32 |
+			(uint64_t) squaring_bytes[u[7]] << 48;
+	}
+}
+
+/* Alg 2.40 - Modular reduction (one bit at a time) */
+
+int has_reduction_precomputed = 0;
+
+uint64_t reduction_polynomials[64][2];
+
+void reduction_generic_precompute() {
+	reduction_polynomials[0][0] = r[0];
+	reduction_polynomials[0][1] = r[1];
+	for(int i = 1; i < 64; i++) {
+		reduction_polynomials[i][0] = reduction_polynomials[i-1][0];
+		reduction_polynomials[i][1] = reduction_polynomials[i-1][1];
+		lshift_polynomial(reduction_polynomials[i], 2);
+	}
+	
+	has_reduction_precomputed = 1;
+}
+
+/*
+ * Reduces c mod f, 
+ * after which only the first 2 indices are guaranteed to be correct.
+ * Precondition:
+ * 	c has at most degree 2m-2
+ *		c has length 4
+ */
+void reduction_generic(uint64_t * c) {
+	/* Step 1 */
+	if(!has_reduction_precomputed) {
+		reduction_generic_precompute();
+	}
+	/* Step 2 */
+	uint64_t digit_val = pow2to63 / 8;
+	int index = 3;
+	for(int digit = 252; digit >= 127; digit--) {
+		/* Step 2.1 */
+		if((c[index] & digit_val) == digit_val) {
+			int j = (digit - 127)/64;
+			int k = (digit - 127) - 64*j;
+			add(reduction_polynomials[k], &c[j], &c[j]);
+		}
+		
+		if(digit % 64 == 0) {
+			digit_val = pow2to63;
+			index--;
+		} else {
+			digit_val /= 2;
+		}
+	}
+	//Algorithm in book is slightly wrong for some f, here is a general fix:
+	c[1] &= 0x7FFFFFFFFFFFFFFF;
+	c[2] = c[3] = 0;
+}
+
+/* Word-level reduction, specific to f = z^127 + z^63 + 1 */
+
+/*
+* Preconditions:
+* 	c has at most degree 253
+*	c has length 4
+*/
+void reduction_trinomial(uint64_t * c) {
+	FOLD_TRINOMIAL(c[0], c[1], c[2], c[3], c[0], c[1]);
+	c[2] = c[3] = 0;
+}
+
+/*  Alg 2.47 Extended Euclidean algorithm for binary polynomials */
+
+/*
+* Preconditions:
+*	a has length 2
+*/
+int degree_oldreference(uint64_t * a) {
+	int digit = 63;
+	uint64_t digit_val = pow2to63;
+	int j;
+	if(a[1] == 0) {
+		j = 0; 
+	} else {
+		j = 1;
+	}
+	while(digit >= 0 && (a[j] & digit_val) == 0) {
+		digit--;
+		digit_val /= 2;
+	}
+	if(digit < 0) {
+		return 0;
+	} else {
+		return 64*j + digit;
+	}
+}
+
+int degree_len2(uint64_t * a) {
+	if(a[1] == 0) {
+		if(a[0] == 0) {
+			return 0;
+		}
+		int upper = a[0] >> 32;
+		if(upper == 0) {
+			return 31 - __builtin_clz(a[0]);
+		}
+		return 63 - __builtin_clz(upper);
+	} else {
+		int upper = a[1] >> 32;
+		if(upper == 0) {
+			return 95 - __builtin_clz(a[1]);
+		}
+		return 127 - __builtin_clz(upper);
+	}
+}
+
+int degree(uint64_t * a, int len) {
+	int degree = 0;
+	for(int i = len -1; i >= 0; i--) {
+		if(a[i] == 0) {
+			continue;
+		}
+		int upper = a[i] >> 32;
+		if(upper == 0) {
+			return 31 + 64*i - __builtin_clz(a[i]);
+		}
+		return 63 + 64*i - __builtin_clz(upper);
+	}
+}
+
+/*
+* Precondition:
+*	a and b have min length len
+*/
+void swap_arrays(uint64_t * a, uint64_t * b, int len) {
+	for(int i = 0; i < len; i++) {
+		uint64_t temp = a[i];
+		a[i] = b[i];
+		b[i] = temp;
+	}
+}	
+
+void lshift_polynomial_optimized(uint64_t * a, int shift) {
+	if(shift == 0) {
+		return;
+	} else if(shift > 63) {
+		a[1] = a[0] << (shift - 64);
+		a[0] = 0;
+	} else {
+		uint64_t carry = a[0] >> (64 - shift);
+		a[0] <<= shift;
+		a[1] <<= shift;
+		a[1] |= carry;
+	}
+}
+
+void rshift_polynomial_optimized(uint64_t * a, int shift) {
+	if(shift == 0) {
+		return;
+	} else if(shift > 63) {
+		a[0] = a[1] >> (shift - 64);
+		a[1] = 0;
+	} else {
+		uint64_t carry = a[1] << (64 - shift);
+		a[0] >>= shift;
+		a[1] >>= shift;
+		a[0] |= carry;
+	}
+}
+
+/*
+* Output is d = gcd(a,b), and g,h so that ag + bh = d
+* Preconditions:
+*	All arrays have length 2
+* 	0 < degree(a) <= degree(b)
+*/
+void extended_euclid(uint64_t * a, uint64_t * b, uint64_t * d, uint64_t * g, uint64_t * h) {
+	/* Step 1, the buffers live on the stack and the swaps exchange pointers */
+	uint64_t u_buf[2];
+	uint64_t v_buf[2];
+	uint64_t * u = u_buf;
+	uint64_t * v = v_buf;
+	memcpy(u, a, sizeof(uint64_t)*2);
+	memcpy(v, b, sizeof(uint64_t)*2);
+	//int deg_u = degree_len2(u);
+	int deg_u;
+	if(u[1] == 0) {
+		if(u[0] == 0) {
+			deg_u = 0;
+		} else {
+			int upper = u[0] >> 32;
+			if(upper == 0) {
+				deg_u = 31 - __builtin_clz(u[0]);
+			} else {
+				deg_u = 63 - __builtin_clz(upper);
+			}
+		}
+	} else {
+		int upper = u[1] >> 32;
+		if(upper == 0) {
+			deg_u = 95 - __builtin_clz(u[1]);
+		} else {
+			deg_u = 127 - __builtin_clz(upper);
+		}
+	}
+	//int deg_v = degree_len2(v);
+	int deg_v;
+	if(v[1] == 0) {
+		if(v[0] == 0) {
+			deg_v = 0;
+		} else {
+			int upper = v[0] >> 32;
+			if(upper == 0) {
+				deg_v = 31 - __builtin_clz(v[0]);
+			} else {
+				deg_v = 63 - __builtin_clz(upper);
+			}
+		}
+	} else {
+		int upper = v[1] >> 32;
+		if(upper == 0) {
+			deg_v = 95 - __builtin_clz(v[1]);
+		} else {
+			deg_v = 127 - __builtin_clz(upper);
+		}
+	}
+
+	/* Step 2 */ //Size might be wrong but my logic is that deg(u)-deg(v) is max 126, and original g1 can only feed from u-v so this is max degree
+	uint64_t g1_buf[2] = {1, 0};
+	uint64_t g2_buf[2] = {0, 0};
+	uint64_t h1_buf[2] = {0, 0};
+	uint64_t h2_buf[2] = {1, 0};
+	uint64_t * g1 = g1_buf;
+	uint64_t * g2 = g2_buf;
+	uint64_t * h1 = h1_buf;
+	uint64_t * h2 = h2_buf;
+	
+	/* Step 3 */
+	while (u[0] > 0 || u[1] > 0) {
+		/* Step 3.1 */
+		int j = deg_u - deg_v;
+		
+		/* Step 3.2 */
+		if(j < 0) {
+			uint64_t * tmp = u;
+			u = v;
+			v = tmp;
+			
+			tmp = g1;
+			g1 = g2;
+			g2 = tmp;
+			
+			tmp = h1;
+			h1 = h2;
+			h2 = tmp;
+			
+			j = -j;
+			
+			int temp8 = deg_u;
+			deg_u =  deg_v;
+			deg_v = temp8;
+		}
+		
+		/* Step 3.3 */
+		uint64_t shift_polynomial[2];
+		memcpy(shift_polynomial, v, sizeof(uint64_t)*2);
+		//lshift_polynomial_optimized(shift_polynomial, j);
+		if(j != 0) {
+			if(j > 63) {
+				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
+				shift_polynomial[0] = 0;
+			} else {
+				uint64_t carry = shift_polynomial[0] >> (64 - j);
+				shift_polynomial[0] <<= j;
+				shift_polynomial[1] <<= j;
+				shift_polynomial[1] |= carry;
+			}
+		}
+		//add(shift_polynomial, u, u);
+		u[0] = shift_polynomial[0] ^ u[0];
+		u[1] = shift_polynomial[1] ^ u[1];
+		//deg_u = degree_len2(u);
+		if(u[1] == 0) {
+			if(u[0] == 0) {
+				deg_u = 0;
+			} else {
+				int upper = u[0] >> 32;
+				if(upper == 0) {
+					deg_u = 31 - __builtin_clz(u[0]);
+				} else {
+					deg_u = 63 - __builtin_clz(upper);
+				}
+			}
+		} else {
+			int upper = u[1] >> 32;
+			if(upper == 0) {
+				deg_u = 95 - __builtin_clz(u[1]);
+			} else {
+				deg_u = 127 - __builtin_clz(upper);
+			}
+		}
+		
+		/*Step 3.4 */
+		memcpy(shift_polynomial, g2, sizeof(uint64_t)*2);
+		//lshift_polynomial_optimized(shift_polynomial, j);
+		if(j != 0) {
+			if(j > 63) {
+				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
+				shift_polynomial[0] = 0;
+			} else {
+				uint64_t carry = shift_polynomial[0] >> (64 - j);
+				shift_polynomial[0] <<= j;
+				shift_polynomial[1] <<= j;
+				shift_polynomial[1] |= carry;
+			}
+		}
+		//add(shift_polynomial, g1, g1);
+		g1[0] = shift_polynomial[0] ^ g1[0];
+		g1[1] = shift_polynomial[1] ^ g1[1];
+		
+		memcpy(shift_polynomial, h2, sizeof(uint64_t)*2);
+		//lshift_polynomial_optimized(shift_polynomial, j);
+		if(j != 0) {
+			if(j > 63) {
+				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
+				shift_polynomial[0] = 0;
+			} else {
+				uint64_t carry = shift_polynomial[0] >> (64 - j);
+				shift_polynomial[0] <<= j;
+				shift_polynomial[1] <<= j;
+				shift_polynomial[1] |= carry;
+			}
+		}
+		//add(shift_polynomial, h1, h1);
+		h1[0] = shift_polynomial[0] ^ h1[0];
+		h1[1] = shift_polynomial[1] ^ h1[1];
+	}
+	/* Step 4 */
+	//swap_arrays(d, v, 2);
+	d[0] = v[0];
+	d[1] = v[1];
 	//swap_arrays(g, g2, 2);
 	g[0] = g2[0];
 	g[1] = g2[1];
 	//swap_arrays(h, h2, 2);
 	h[0] = h2[0];
 	h[1] = h2[1];
-	free(u);
-	free(v);
-	free(g1);
-	free(g2);
-	free(h1);
-	free(h2);
 }
 
-/* 
-* Alg 2.48 - Inversion in binary field using the extended Euclidean algorithm
-* Preconditions:
-* 	Arrays have length 2
-*	a has max degree 126 and is nonzero
-*/
-void inv_euclid(uint64_t * a, uint64_t * inv_a) {
-	/* Step 1 */
-	uint64_t * u = malloc(2* sizeof(uint64_t));
-	uint64_t * v = malloc(2*sizeof(uint64_t));
-	memcpy(u, a, sizeof(uint64_t)*2);
-	memcpy(v, f, sizeof(uint64_t)*2);
-	int deg_u;
-	/* Calculating degree of u */
-	if(u[1] == 0) {
-		if(u[0] == 0) {
-			deg_u = 0;
-		} else {
-			int upper = u[0] >> 32;
-			if(upper == 0) {
-				deg_u = 31 - __builtin_clz(u[0]);
-			} else {
-				deg_u = 63 - __builtin_clz(upper);
-			}
+/* 
+* Alg 2.48 - Inversion in binary field using the extended Euclidean algorithm
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126 and is nonzero
+*/
+void inv_euclid(uint64_t * a, uint64_t * inv_a) {
+	/* Step 1, the buffers live on the stack and the swaps exchange pointers */
+	uint64_t u_buf[2];
+	uint64_t v_buf[2];
+	uint64_t * u = u_buf;
+	uint64_t * v = v_buf;
+	memcpy(u, a, sizeof(uint64_t)*2);
+	memcpy(v, f, sizeof(uint64_t)*2);
+	int deg_u;
+	/* Calculating degree of u */
+	if(u[1] == 0) {
+		if(u[0] == 0) {
+			deg_u = 0;
+		} else {
+			int upper = u[0] >> 32;
+			if(upper == 0) {
+				deg_u = 31 - __builtin_clz(u[0]);
+			} else {
+				deg_u = 63 - __builtin_clz(upper);
+			}
+		}
+	} else {
+		int upper = u[1] >> 32;
+		if(upper == 0) {
+			deg_u = 95 - __builtin_clz(u[1]);
+		} else {
+			deg_u = 127 - __builtin_clz(upper);
+		}
+	}
+	//int deg_u = degree_len2(u);
+	int deg_v = 127;
+
+	/* Step 2 */ //Size might be wrong but my logic is that deg(u)-deg(v) is max 126, and original g1 can only feed from u-v so this is max degree
+	uint64_t g1_buf[2] = {1, 0};
+	uint64_t g2_buf[2] = {0, 0};
+	uint64_t * g1 = g1_buf;
+	uint64_t * g2 = g2_buf;
+	
+	/* Step 3 */
+	while (!(u[0] == 1 && u[1] == 0)) {
+		/* Step 3.1 */
+		int j = deg_u - deg_v;
+		
+		/* Step 3.2 */
+		if(j < 0) {
+			//swap_arrays(u, v, 2);
+			uint64_t * tmp = u;
+			u = v;
+			v = tmp;
+			
+			tmp = g1;
+			g1 = g2;
+			g2 = tmp;
+			//swap_arrays(g1, g2, 2);
+			
+			j = -j;
+			
+			int temp8 = deg_u;
+			deg_u =  deg_v;
+			deg_v = temp8;
+		}
+		/* Step 3.3 */
+		uint64_t shift_polynomial[2];
+		/* shift v */
+		memcpy(shift_polynomial, v, sizeof(uint64_t)*2);
+		if(j != 0) {
+			if(j > 63) {
+				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
+				shift_polynomial[0] = 0;
+			} else {
+				uint64_t carry = shift_polynomial[0] >> (64 - j);
+				shift_polynomial[0] <<= j;
+				shift_polynomial[1] <<= j;
+				shift_polynomial[1] |= carry;
+			}
+		}
+		//lshift_polynomial_optimized(shift_polynomial, j);
+		u[0] = shift_polynomial[0] ^ u[0];
+		u[1] = shift_polynomial[1] ^ u[1];
+		//add(shift_polynomial, u, u);
+		
+		/* Calculating degree of u */
+		if(u[1] == 0) {
+			if(u[0] == 0) {
+				deg_u = 0;
+			} else {
+				int upper = u[0] >> 32;
+				if(upper == 0) {
+					deg_u = 31 - __builtin_clz(u[0]);
+				} else {
+					deg_u = 63 - __builtin_clz(upper);
+				}
+			}
+		} else {
+			int upper = u[1] >> 32;
+			if(upper == 0) {
+				deg_u = 95 - __builtin_clz(u[1]);
+			} else {
+				deg_u = 127 - __builtin_clz(upper);
+			}
+		}
+		//deg_u = degree_len2(u);
+		
+		/*Step 3.4 */
+		/*shift g2 */
+		memcpy(shift_polynomial, g2, sizeof(uint64_t)*2);
+		if(j != 0) {
+			if(j > 63) {
+				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
+				shift_polynomial[0] = 0;
+			} else {
+				uint64_t carry = shift_polynomial[0] >> (64 - j);
+				shift_polynomial[0] <<= j;
+				shift_polynomial[1] <<= j;
+				shift_polynomial[1] |= carry;
+			}
+		}
+		//lshift_polynomial_optimized(shift_polynomial, j);
+		g1[0] = shift_polynomial[0] ^ g1[0];
+		g1[1] = shift_polynomial[1] ^ g1[1];
+		//add(shift_polynomial, g1, g1);
+	}
+	/* Step 4 */
+	inv_a[0] = g1[0];
+	inv_a[1] = g1[1];
+}
+
+/*
+* Alg 2.49 - Binary Inversion Algorithm
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126
+*/
+void inv_binary(uint64_t * a, uint64_t * inv_a) {
+	/* Step 1 */
+	uint64_t u[2];
+	uint64_t v[2];
+	memcpy(u, a, sizeof(uint64_t)*2);
+	memcpy(v, f, sizeof(uint64_t)*2);
+	
+	/* Step 2 */
+	uint64_t g1[2] = {1, 0 };
+	uint64_t g2[2] = {0, 0 };
+	
+	/* Step 3 */
+	while(!(u[0] == 1 && u[1] == 0) && !(v[0] == 1 && v[1] == 0)) {
+		/* Step 3.1 */
+		while(u[0] % 2 == 0) {
+			rshift_polynomial(u, 2);
+			if(g1[0] % 2 == 1) {
+				add(f, g1, g1);
+			}
+			rshift_polynomial(g1, 2);
+		}
+		/* Step 3.2 */
+		while(v[0] % 2 == 0) {
+			rshift_polynomial(v, 2);
+			if(g2[0] % 2 == 1) {
+				add(f, g2, g2);
+			}
+			rshift_polynomial(g2, 2);
+		}
+		/* Step 3.3 */
+		if(u[1] > v[1] || (u[1] == v[1] && u[0] > v[0])) {
+			add(v, u, u);
+			add(g2, g1, g1);
+		} else {
+			add(u, v, v);
+			add(g1, g2, g2);
+		}
+	}
+	/* Step 4 */
+	if(u[0] == 1 && u[1] == 0) {
+		swap_arrays(inv_a, g1, 2);
+	} else {
+		swap_arrays(inv_a, g2, 2);
+	}
+}
+
+/* Almost Inverse Algorithm, the factors of z are stripped a word at a time */
+
+/* Bound on k in b = a^-1 * z^k, at most 2*127 */
+#define ALMOST_INVERSE_MAX_K 254
+
+int has_almost_inverse_precomputed = 0;
+
+/* z^-k mod f for k = 0 ... ALMOST_INVERSE_MAX_K */
+uint64_t almost_inverse_table[ALMOST_INVERSE_MAX_K + 1][2];
+
+void almost_inverse_precompute() {
+	uint64_t t[2] = {1, 0};
+	for(int k = 0; k <= ALMOST_INVERSE_MAX_K; k++) {
+		almost_inverse_table[k][0] = t[0];
+		almost_inverse_table[k][1] = t[1];
+		/* t*z^-1 = (t + t(0)*f)/z */
+		uint64_t odd = -(t[0] & 1);
+		t[0] ^= f[0] & odd;
+		t[1] ^= f[1] & odd;
+		rshift_polynomial_optimized(t, 1);
+	}
+	has_almost_inverse_precomputed = 1;
+}
+
+/*
+* Alg 2.50 - Almost Inverse Algorithm, b = a^-1 * z^k with the trailing
+* zeros of u removed at once by __builtin_ctzll. Returns k.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126 and is nonzero
+*/
+int almost_inverse(uint64_t * a, uint64_t * b) {
+	/* Step 1 */
+	uint64_t u[2];
+	uint64_t v[2];
+	memcpy(u, a, sizeof(uint64_t)*2);
+	memcpy(v, f, sizeof(uint64_t)*2);
+	uint64_t c[2] = {0, 0};
+	int k = 0;
+	b[0] = 1;
+	b[1] = 0;
+	
+	/* Step 2 */
+	while(1) {
+		/* Step 2.1, u = u/z^t and c = c*z^t */
+		int t = u[0] != 0 ? __builtin_ctzll(u[0]) : 64 + __builtin_ctzll(u[1]);
+		rshift_polynomial_optimized(u, t);
+		lshift_polynomial_optimized(c, t);
+		k += t;
+		
+		/* Step 2.2 */
+		if(u[0] == 1 && u[1] == 0) {
+			break;
+		}
+		
+		/* Step 2.3, comparing as integers orders the degrees */
+		if(u[1] < v[1] || (u[1] == v[1] && u[0] < v[0])) {
+			swap_arrays(u, v, 2);
+			swap_arrays(b, c, 2);
+		}
+		
+		/* Step 2.4 */
+		u[0] ^= v[0];
+		u[1] ^= v[1];
+		b[0] ^= c[0];
+		b[1] ^= c[1];
+	}
+	
+	return k;
+}
+
+/*
+* a^-1 = b * z^-k with a single field_mul by a table entry.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126 and is nonzero
+*/
+void inv_almost_inverse(uint64_t * a, uint64_t * inv_a) {
+	if(!has_almost_inverse_precomputed) {
+		almost_inverse_precompute();
+	}
+	uint64_t b[2];
+	int k = almost_inverse(a, b);
+	field_mul(b, almost_inverse_table[k], inv_a);
+}
+
+/* Itoh-Tsujii inversion, a^-1 = a^(2^127 - 2) = (a^(2^126 - 1))^2 */
+
+/*
+* beta_k = a^(2^k - 1) with beta_(i+j) = beta_i^(2^j) * beta_j, along the
+* addition chain 1, 2, 3, 6, 12, 15, 30, 60, 63, 126. MULTISQUARE(x, k, y)
+* sets y = x^(2^k).
+*/
+#define ITOH_TSUJII_CHAIN(MULTISQUARE, a, inv_a) do { \
+	uint64_t b1[2]; \
+	uint64_t b3[2]; \
+	uint64_t t[2]; \
+	field_canonicalize(a, b1); \
+	\
+	field_square(b1, t); \
+	field_mul(t, b1, t);         /* 2 */ \
+	field_square(t, t); \
+	field_mul(t, b1, b3);        /* 3 */ \
+	MULTISQUARE(b3, 3, t); \
+	field_mul(t, b3, t);         /* 6 */ \
+	uint64_t b6[2] = {t[0], t[1]}; \
+	MULTISQUARE(t, 6, t); \
+	field_mul(t, b6, t);         /* 12 */ \
+	MULTISQUARE(t, 3, t); \
+	field_mul(t, b3, t);         /* 15 */ \
+	uint64_t b15[2] = {t[0], t[1]}; \
+	MULTISQUARE(t, 15, t); \
+	field_mul(t, b15, t);        /* 30 */ \
+	uint64_t b30[2] = {t[0], t[1]}; \
+	MULTISQUARE(t, 30, t); \
+	field_mul(t, b30, t);        /* 60 */ \
+	MULTISQUARE(t, 3, t); \
+	field_mul(t, b3, t);         /* 63 */ \
+	uint64_t b63[2] = {t[0], t[1]}; \
+	MULTISQUARE(t, 63, t); \
+	field_mul(t, b63, t);        /* 126 */ \
+	field_square(t, inv_a); \
+} while(0)
+
+/*
+* Squarings one at a time, so that no address depends on a.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void inv_itoh_tsujii(uint64_t * a, uint64_t * inv_a) {
+	ITOH_TSUJII_CHAIN(field_multisquare_iterated, a, inv_a);
+}
+
+/*
+* Multi-squarings through the tables of field_multisquare.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void inv_itoh_tsujii_table(uint64_t * a, uint64_t * inv_a) {
+	ITOH_TSUJII_CHAIN(field_multisquare, a, inv_a);
+}
+
+/* Division b/a, the Almost Inverse is multiplied by b and z^k is divided out */
+
+/*
+* c = a*z^-k mod f. Below z^63 the polynomial f is 1, so adding m*f for
+* the low s <= 63 bits m of a clears them, and the sum is shifted down
+* by s bits.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void div_monomial(uint64_t * a, int k, uint64_t * c) {
+	uint64_t c0 = a[0];
+	uint64_t c1 = a[1];
+	while(k > 0) {
+		int s = k < 63 ? k : 63;
+		uint64_t m = c0 & (((uint64_t) 1 << s) - 1);
+		/* c + m*(z^127 + z^63 + 1), the low s bits are zero */
+		uint64_t w0 = c0 ^ m ^ (m << 63);
+		uint64_t w1 = c1 ^ (m >> 1) ^ (m << 63);
+		uint64_t w2 = m >> 1;
+		c0 = (w0 >> s) | (w1 << (64 - s));
+		c1 = (w1 >> s) | (w2 << (64 - s));
+		k -= s;
+	}
+	c[0] = c0;
+	c[1] = c1;
+}
+
+/*
+* b/a = b * a^-1 * z^k * z^-k, the multiplication by the z^-k table entry
+* of inv_almost_inverse is replaced by div_monomial, so the division costs
+* one field_mul on top of almost_inverse.
+* Preconditions:
+* 	Arrays have length 2
+*	a,b have max degree 126 and a is nonzero
+*/
+void field_div_almost_inverse(uint64_t * b, uint64_t * a, uint64_t * c) {
+	uint64_t t[2];
+	int k = almost_inverse(a, t);
+	field_mul(b, t, t);
+	div_monomial(t, k, c);
+}
+
+/*
+* Preconditions:
+* 	Arrays have length 2
+*	a,b have max degree 126 and a is nonzero
+*/
+void field_div(uint64_t * b, uint64_t * a, uint64_t * c) {
+	uint64_t inv_a[2];
+	inv_itoh_tsujii_table(a, inv_a);
+	field_mul(b, inv_a, c);
+}
+
+/* Constant-time inversion with the divsteps of Bernstein and Yang's safegcd */
+
+/* Divsteps per transition matrix, the entries stay below z^63 */
+#define SAFEGCD_BATCH 62
+
+/* Divsteps that bring g to 0 from deg f = 127 and deg g <= 126 */
+#define SAFEGCD_STEPS 253
+
+/*
+* s divsteps on the low words of f and g, f odd and s <= 62. A step only
+* reads bit 0 of f and g, so the low words decide the first 62 steps.
+* Writes m = {u, v, q, r} with z^s*f' = u*f + v*g, z^s*g' = q*f + r*g
+* and returns the new delta. The swap is done with masks, so the
+* operations do not depend on the data.
+*/
+int64_t safegcd_divsteps(int64_t delta, uint64_t f, uint64_t g, int s, uint64_t * m) {
+	uint64_t u = 1, v = 0, q = 0, r = 1;
+	for(int i = 0; i < s; i++) {
+		/* delta > 0 and g odd: (f, g) = (g, f) and delta = -delta */
+		uint64_t swap = -((((uint64_t) -delta) >> 63) & g & 1);
+		uint64_t t = (f ^ g) & swap;
+		f ^= t;
+		g ^= t;
+		t = (u ^ q) & swap;
+		u ^= t;
+		q ^= t;
+		t = (v ^ r) & swap;
+		v ^= t;
+		r ^= t;
+		delta = (delta ^ (int64_t) swap) - (int64_t) swap;
+		
+		/* g = (g + g(0)*f)/z, the first row is scaled by z instead */
+		uint64_t odd = -(g & 1);
+		g ^= f & odd;
+		q ^= u & odd;
+		r ^= v & odd;
+		delta++;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	m[0] = u;
+	m[1] = v;
+	m[2] = q;
+	m[3] = r;
+	return delta;
+}
+
+/* (p, t) = (u*x + v*y, q*x + r*y) for m = {u, v, q, r}, x,y of length 2, p,t of length 3 */
+#define SAFEGCD_TRANSFORM(CLMUL64, m, x, y, p, t) do { \
+	uint64_t * in_[2] = {(x), (y)}; \
+	uint64_t * out_[2] = {(p), (t)}; \
+	for(int i_ = 0; i_ < 2; i_++) { \
+		out_[i_][0] = 0; \
+		out_[i_][1] = 0; \
+		out_[i_][2] = 0; \
+		for(int j_ = 0; j_ < 2; j_++) { \
+			for(int k_ = 0; k_ < 2; k_++) { \
+				uint64_t w_[2]; \
+				CLMUL64((m)[2*i_ + j_], in_[j_][k_], w_); \
+				out_[i_][k_] ^= w_[0]; \
+				out_[i_][k_ + 1] ^= w_[1]; \
+			} \
+		} \
+	} \
+} while(0)
+
+TARGET_PCLMUL
+void safegcd_transform_clmul(uint64_t * m, uint64_t * x, uint64_t * y, uint64_t * p, uint64_t * t) {
+	SAFEGCD_TRANSFORM(clmul64_pclmul, m, x, y, p, t);
+}
+
+void safegcd_transform_software(uint64_t * m, uint64_t * x, uint64_t * y, uint64_t * p, uint64_t * t) {
+	SAFEGCD_TRANSFORM(clmul64_holes, m, x, y, p, t);
+}
+
+int has_safegcd_dispatched = 0;
+
+void (*safegcd_transform_kernel)(uint64_t * m, uint64_t * x, uint64_t * y, uint64_t * p, uint64_t * t);
+
+void safegcd_dispatch() {
+	if(cpu_supports_pclmul()) {
+		safegcd_transform_kernel = safegcd_transform_clmul;
+	} else {
+		safegcd_transform_kernel = safegcd_transform_software;
+	}
+	has_safegcd_dispatched = 1;
+}
+
+/* c = p mod z^127 + z^64 + 1, p of max degree 189 */
+void safegcd_reduce(uint64_t * p, uint64_t * c) {
+	uint64_t h = (p[1] >> 63) | (p[2] << 1);
+	c[0] = p[0] ^ h;
+	c[1] = (p[1] & 0x7FFFFFFFFFFFFFFF) ^ h;
+}
+
+/*
+* The divsteps run on the reversed polynomials f = z^127*F(1/z) = z^127 + z^64 + 1
+* and g = z^126*a(1/z), where they act like Euclid's algorithm on F and a.
+* v tracks the coefficient of g modulo f, and ends as z^253*g^-1 when f = 1.
+* Mapping back with z -> 1/z gives a^-1 = z*rev_126(v), the reversal of v
+* over 128 bits.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void inv_safegcd(uint64_t * a, uint64_t * inv_a) {
+	if(!has_safegcd_dispatched) {
+		safegcd_dispatch();
+	}
+	uint64_t b[2];
+	field_canonicalize(a, b);
+	
+	uint64_t f[2] = {1, 0x8000000000000001};
+	uint64_t g[2] = {(rev64(b[1]) >> 1) | (rev64(b[0]) << 63), rev64(b[0]) >> 1};
+	uint64_t v[2] = {0, 0};
+	uint64_t r[2] = {1, 0};
+	int64_t delta = 1;
+	for(int i = 0; i < SAFEGCD_STEPS; i += SAFEGCD_BATCH) {
+		int s = SAFEGCD_STEPS - i < SAFEGCD_BATCH ? SAFEGCD_STEPS - i : SAFEGCD_BATCH;
+		uint64_t m[4];
+		uint64_t p[3];
+		uint64_t t[3];
+		delta = safegcd_divsteps(delta, f[0], g[0], s, m);
+		
+		/* (f, g) = M*(f, g)/z^s, the divisions are exact */
+		safegcd_transform_kernel(m, f, g, p, t);
+		f[0] = (p[0] >> s) | (p[1] << (64 - s));
+		f[1] = (p[1] >> s) | (p[2] << (64 - s));
+		g[0] = (t[0] >> s) | (t[1] << (64 - s));
+		g[1] = (t[1] >> s) | (t[2] << (64 - s));
+		
+		/* (v, r) = M*(v, r) mod f */
+		safegcd_transform_kernel(m, v, r, p, t);
+		safegcd_reduce(p, v);
+		safegcd_reduce(t, r);
+	}
+	
+	uint64_t c[2] = {rev64(v[1]), rev64(v[0])};
+	field_canonicalize(c, inv_a);
+}
+
+/* Batch inversion with Montgomery's trick, one inversion and 3 multiplications per element */
+
+/*
+* Preconditions:
+*   in, out have length 2n, element i is at index 2i, in and out do not overlap
+*   elements of in have max degree 126
+*/
+uint64_t batch_invert(uint64_t * in, uint64_t * out, uint64_t n) {
+	if(n == 0) {
+		return 0;
+	}
+	/* Prefix products into out, a zero element is replaced by 1 */
+	uint64_t zeros = 0;
+	uint64_t acc[2] = {1, 0};
+	for(uint64_t i = 0; i < n; i++) {
+		uint64_t nonzero = -(uint64_t) ((in[2*i] | in[2*i + 1]) != 0);
+		uint64_t x[2] = {(in[2*i] & nonzero) | (1 & ~nonzero), in[2*i + 1] & nonzero};
+		zeros += 1 & ~nonzero;
+		field_mul(acc, x, acc);
+		out[2*i] = acc[0];
+		out[2*i + 1] = acc[1];
+	}
+	
+	/* One inversion of the product of all elements */
+	uint64_t inv[2];
+	inv_itoh_tsujii(acc, inv);
+	
+	/* Walk back, inv is the inverse of the prefix product up to i */
+	for(uint64_t i = n - 1; i > 0; i--) {
+		uint64_t nonzero = -(uint64_t) ((in[2*i] | in[2*i + 1]) != 0);
+		uint64_t x[2] = {(in[2*i] & nonzero) | (1 & ~nonzero), in[2*i + 1] & nonzero};
+		uint64_t inv_i[2];
+		field_mul(inv, &out[2*(i - 1)], inv_i);
+		field_mul(inv, x, inv);
+		out[2*i] = inv_i[0] & nonzero;
+		out[2*i + 1] = inv_i[1] & nonzero;
+	}
+	uint64_t nonzero = -(uint64_t) ((in[0] | in[1]) != 0);
+	out[0] = inv[0] & nonzero;
+	out[1] = inv[1] & nonzero;
+	return zeros;
+}
+
+/* Elements per block of batch_invert_in_place, the scratch is 4 KiB on the stack */
+#define BATCH_INVERT_BLOCK 256
+
+/*
+* Preconditions:
+*   a has length 2n, element i is at index 2i
+*   elements of a have max degree 126
+*/
+uint64_t batch_invert_in_place(uint64_t * a, uint64_t n) {
+	uint64_t scratch[2*BATCH_INVERT_BLOCK];
+	uint64_t zeros = 0;
+	for(uint64_t i = 0; i < n; i += BATCH_INVERT_BLOCK) {
+		uint64_t len = n - i < BATCH_INVERT_BLOCK ? n - i : BATCH_INVERT_BLOCK;
+		zeros += batch_invert(&a[2*i], scratch, len);
+		memcpy(&a[2*i], scratch, sizeof(uint64_t)*2*len);
+	}
+	return zeros;
+}
+
+/* Lane-parallel inversion of independent elements, each zero maps to zero on its own */
+
+/*
+* The addition chain of inv_itoh_tsujii on LANES*REGS elements at a time,
+* one per 128-bit lane of REGS registers. The registers are independent, so
+* their squarings overlap in the pipeline. The n % (LANES*REGS) elements left
+* after the last full block run through inv_itoh_tsujii.
+* Defines multisquare_SUFFIX, mult_SUFFIX and NAME over the lane kernels
+* field_mul_SUFFIX and field_square_SUFFIX on vectors of type VEC.
+*/
+#define DEFINE_INV_ARRAY(NAME, SUFFIX, TARGET, VEC, LANES, REGS, LOAD, STORE) \
+__attribute__((target(TARGET))) \
+void multisquare_##SUFFIX(VEC * x, int k) { \
+	for(int i = 0; i < k; i++) { \
+		for(int r = 0; r < (REGS); r++) { \
+			x[r] = field_square_##SUFFIX(x[r]); \
+		} \
+	} \
+} \
+__attribute__((target(TARGET))) \
+void mult_##SUFFIX(VEC * x, VEC * y) { \
+	for(int r = 0; r < (REGS); r++) { \
+		x[r] = field_mul_##SUFFIX(x[r], y[r]); \
+	} \
+} \
+__attribute__((target(TARGET))) \
+void NAME(uint64_t * a, uint64_t * c, uint64_t n) { \
+	uint64_t block = (LANES)*(REGS); \
+	uint64_t i = 0; \
+	for(; n - i >= block; i += block) { \
+		uint64_t buf[2*(LANES)*(REGS)]; \
+		memcpy(buf, &a[2*i], sizeof(buf)); \
+		VEC b1[REGS]; \
+		VEC b3[REGS]; \
+		VEC b6[REGS]; \
+		VEC b15[REGS]; \
+		VEC b30[REGS]; \
+		VEC b63[REGS]; \
+		VEC t[REGS]; \
+		for(int r = 0; r < (REGS); r++) { \
+			b1[r] = LOAD((void *) &buf[2*(LANES)*r]); \
+			t[r] = b1[r]; \
+		} \
+		multisquare_##SUFFIX(t, 1); \
+		mult_##SUFFIX(t, b1);              /* 2 */ \
+		multisquare_##SUFFIX(t, 1); \
+		mult_##SUFFIX(t, b1);              /* 3 */ \
+		memcpy(b3, t, sizeof(t)); \
+		multisquare_##SUFFIX(t, 3); \
+		mult_##SUFFIX(t, b3);              /* 6 */ \
+		memcpy(b6, t, sizeof(t)); \
+		multisquare_##SUFFIX(t, 6); \
+		mult_##SUFFIX(t, b6);              /* 12 */ \
+		multisquare_##SUFFIX(t, 3); \
+		mult_##SUFFIX(t, b3);              /* 15 */ \
+		memcpy(b15, t, sizeof(t)); \
+		multisquare_##SUFFIX(t, 15); \
+		mult_##SUFFIX(t, b15);             /* 30 */ \
+		memcpy(b30, t, sizeof(t)); \
+		multisquare_##SUFFIX(t, 30); \
+		mult_##SUFFIX(t, b30);             /* 60 */ \
+		multisquare_##SUFFIX(t, 3); \
+		mult_##SUFFIX(t, b3);              /* 63 */ \
+		memcpy(b63, t, sizeof(t)); \
+		multisquare_##SUFFIX(t, 63); \
+		mult_##SUFFIX(t, b63);             /* 126 */ \
+		multisquare_##SUFFIX(t, 1); \
+		for(int r = 0; r < (REGS); r++) { \
+			STORE((void *) &buf[2*(LANES)*r], t[r]); \
+		} \
+		memcpy(&c[2*i], buf, sizeof(buf)); \
+	} \
+	/* A short tail would waste most of a block, it runs one at a time */ \
+	for(; i < n; i++) { \
+		inv_itoh_tsujii(&a[2*i], &c[2*i]); \
+	} \
+}
+
+#ifdef BINARYFIELD_X86
+/*
+* Both kernels run 8 elements per block, in two 512-bit registers of four
+* lanes or in four 256-bit registers of two lanes. With only two 256-bit
+* registers the squarings do not overlap enough to beat inv_itoh_tsujii.
+*/
+DEFINE_INV_ARRAY(inv_array_vpclmul, x4, "avx512f,avx512bw,vpclmulqdq", __m512i, 4, 2,
+	_mm512_loadu_si512, _mm512_storeu_si512)
+
+DEFINE_INV_ARRAY(inv_array_vpclmul_avx2, x2, "avx2,vpclmulqdq", __m256i, 2, 4,
+	_mm256_loadu_si256, _mm256_storeu_si256)
+#else
+void inv_array_vpclmul(uint64_t * a, uint64_t * c, uint64_t n) {
+	inv_array_generic(a, c, n);
+}
+
+void inv_array_vpclmul_avx2(uint64_t * a, uint64_t * c, uint64_t n) {
+	inv_array_generic(a, c, n);
+}
+#endif
+
+void inv_array_generic(uint64_t * a, uint64_t * c, uint64_t n) {
+	for(uint64_t i = 0; i < n; i++) {
+		inv_itoh_tsujii(&a[2*i], &c[2*i]);
+	}
+}
+
+int has_inv_array_dispatched = 0;
+
+void (*inv_array_kernel)(uint64_t * a, uint64_t * c, uint64_t n);
+
+void inv_array_dispatch() {
+	if(cpu_supports_vpclmul()) {
+		inv_array_kernel = inv_array_vpclmul;
+	} else if(cpu_supports_vpclmul_avx2()) {
+		inv_array_kernel = inv_array_vpclmul_avx2;
+	} else {
+		inv_array_kernel = inv_array_generic;
+	}
+	has_inv_array_dispatched = 1;
+}
+
+/*
+* Preconditions:
+*   a, c have length 2n, element i is at index 2i, a and c may be the same array
+*   elements of a have max degree 127
+*/
+void inv_array(uint64_t * a, uint64_t * c, uint64_t n) {
+	if(!has_inv_array_dispatched) {
+		inv_array_dispatch();
+	}
+	inv_array_kernel(a, c, n);
+}
+
+/* Trace, half-trace and the quadratic equation x^2 + x = c */
+
+/*
+* Tr(c) = c + c^2 + ... + c^(2^126) is GF(2)-linear, so it is the parity of
+* c masked by the traces of the basis. For f = z^127 + z^63 + 1 only
+* Tr(1) = 1, and z^127 = z^63 + 1 has trace 1 in the redundant form.
+* Preconditions:
+*   a is of max degree 127, length 2
+*/
+uint64_t field_trace(uint64_t * a) {
+	return (a[0] ^ (a[1] >> 63)) & 1;
+}
+
+int has_halftrace_precomputed = 0;
+
+/* H(z^(8j) * v) for every byte position j and byte value v, 64 KiB */
+uint64_t halftrace_table[16][256][2];
+
+/* H(c) = sum of c^(4^i) for i = 0 ... 63, with 126 squarings */
+void field_halftrace_iterated(uint64_t * a, uint64_t * c) {
+	uint64_t t[2];
+	field_canonicalize(a, t);
+	uint64_t c0 = 0;
+	uint64_t c1 = 0;
+	for(int i = 0; i < 64; i++) {
+		c0 ^= t[0];
+		c1 ^= t[1];
+		field_square(t, t);
+		field_square(t, t);
+	}
+	c[0] = c0;
+	c[1] = c1;
+}
+
+void halftrace_precompute() {
+	uint64_t basis[128][2];
+	for(int i = 0; i < 128; i++) {
+		uint64_t monomial[2] = {1, 0};
+		mult_monomial(monomial, i, monomial);
+		field_halftrace_iterated(monomial, basis[i]);
+	}
+	linear_map_precompute(basis, halftrace_table);
+	has_halftrace_precomputed = 1;
+}
+
+/*
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void field_halftrace(uint64_t * a, uint64_t * c) {
+	if(!has_halftrace_precomputed) {
+		halftrace_precompute();
+	}
+	linear_map_apply(halftrace_table, a, c);
+}
+
+/*
+* For odd m, H(c)^2 + H(c) = c + Tr(c), so x = H(c) solves x^2 + x = c
+* when Tr(c) = 0. The other solution is x + 1.
+* Preconditions:
+*   Arrays have length 2
+*   c is of max degree 127
+*/
+bool field_solve_quadratic(uint64_t * c, uint64_t * x) {
+	field_halftrace(c, x);
+	return field_trace(c) == 0;
+}
+
+/*
+* Preconditions:
+*   c, x have length 2n, element i is at index 2i
+*   elements of c have max degree 127
+*/
+uint64_t field_solve_quadratic_batch(uint64_t * c, uint64_t * x, bool * solvable, uint64_t n) {
+	if(!has_halftrace_precomputed) {
+		halftrace_precompute();
+	}
+	uint64_t num_solvable = 0;
+	for(uint64_t i = 0; i < n; i++) {
+		linear_map_apply(halftrace_table, &c[2*i], &x[2*i]);
+		solvable[i] = field_trace(&c[2*i]) == 0;
+		num_solvable += solvable[i];
+	}
+	return num_solvable;
+}
+
+/* Field contexts, GF(2^m) for m up to 575 with a sparse reduction polynomial */
+
+/* c ^= t*z^s on single words, the caller keeps s + 63 inside c */
+void xor_shifted_word(uint64_t * c, uint64_t t, int s) {
+	int q = s / 64;
+	int b = s % 64;
+	c[q] ^= t << b;
+	if(b != 0) {
+		c[q+1] ^= t >> (64 - b);
+	}
+}
+
+/* c ^= a*z^s, bits beyond len words are dropped */
+void xor_shifted_array(uint64_t * c, uint64_t * a, int s, int len) {
+	int q = s / 64;
+	int b = s % 64;
+	for(int i = len - 1 - q; i >= 0; i--) {
+		c[i+q] ^= a[i] << b;
+		if(b != 0 && i + q + 1 < len) {
+			c[i+q+1] ^= a[i] >> (64 - b);
+		}
+	}
+}
+
+/* Degree of a, -1 for the zero polynomial */
+int degree_words(uint64_t * a, int len) {
+	for(int i = len - 1; i >= 0; i--) {
+		if(a[i] != 0) {
+			return 64*i + 63 - __builtin_clzll(a[i]);
 		}
-	} else {
-		int upper = u[1] >> 32;
-		if(upper == 0) {
-			deg_u = 95 - __builtin_clz(u[1]);
-		} else {
-			deg_u = 127 - __builtin_clz(upper);
+	}
+	return -1;
+}
+
+/*
+* Word-level reduction with z^m = r(z), one shifted XOR per term of r and word of c.
+* Words above z^m are folded top down, then the bits of the word holding z^m.
+* The fold of a word lands strictly below it since every term is at most m - 64.
+* With M, LEN and the terms known at compile time the loops unroll into
+* straight-line shifts on locals.
+*/
+#define FIELD_REDUCE_SPARSE(M, LEN, terms, num_terms, c) do { \
+	uint64_t w_[2*(LEN)]; \
+	_Pragma("GCC unroll 32") \
+	for(int i_ = 0; i_ < 2*(LEN); i_++) { \
+		w_[i_] = (c)[i_]; \
+	} \
+	_Pragma("GCC unroll 32") \
+	for(int i_ = 2*(LEN) - 1; i_ > (M) / 64; i_--) { \
+		uint64_t t_ = w_[i_]; \
+		_Pragma("GCC unroll 8") \
+		for(int j_ = 0; j_ < (num_terms); j_++) { \
+			int s_ = 64*i_ - (M) + (terms)[j_]; \
+			w_[s_ / 64] ^= t_ << (s_ % 64); \
+			if(s_ % 64 != 0) { \
+				w_[s_ / 64 + 1] ^= t_ >> (64 - s_ % 64); \
+			} \
+		} \
+	} \
+	uint64_t t_ = w_[(M) / 64] >> ((M) % 64); \
+	w_[(M) / 64] &= ((uint64_t) 1 << ((M) % 64)) - 1; \
+	_Pragma("GCC unroll 8") \
+	for(int j_ = 0; j_ < (num_terms); j_++) { \
+		int s_ = (terms)[j_]; \
+		w_[s_ / 64] ^= t_ << (s_ % 64); \
+		if(s_ % 64 != 0) { \
+			w_[s_ / 64 + 1] ^= t_ >> (64 - s_ % 64); \
+		} \
+	} \
+	_Pragma("GCC unroll 32") \
+	for(int i_ = 0; i_ < (LEN); i_++) { \
+		(c)[i_] = w_[i_]; \
+	} \
+	_Pragma("GCC unroll 32") \
+	for(int i_ = (LEN); i_ < 2*(LEN); i_++) { \
+		(c)[i_] = 0; \
+	} \
+} while(0)
+
+/* Any supported modulus, the terms are read from the context */
+void field_ctx_reduce_sparse(field_t * ctx, uint64_t * c) {
+	int m = ctx->m;
+	int len = ctx->len;
+	int top = m / 64;
+	for(int i = 2*len - 1; i > top; i--) {
+		uint64_t t = c[i];
+		c[i] = 0;
+		for(int j = 0; j < ctx->num_terms; j++) {
+			xor_shifted_word(c, t, 64*i - m + ctx->terms[j]);
 		}
 	}
-	//int deg_u = degree_len2(u);
-	int deg_v = 127;
+	uint64_t t = c[top] >> (m % 64);
+	c[top] &= ((uint64_t) 1 << (m % 64)) - 1;
+	for(int j = 0; j < ctx->num_terms; j++) {
+		xor_shifted_word(c, t, ctx->terms[j]);
+	}
+}
 
-	/* Step 2 */ //Size might be wrong but my logic is that deg(u)-deg(v) is max 126, and original g1 can only feed from u-v so this is max degree
-	uint64_t * g1 = malloc(2*sizeof(uint64_t));
+/* The NIST moduli, specialized */
+#define DEFINE_FIELD_CTX_REDUCE(M, LEN, ...) \
+void field_ctx_reduce_##M(field_t * ctx, uint64_t * c) { \
+	(void) ctx; \
+	const int terms[] = {__VA_ARGS__}; \
+	FIELD_REDUCE_SPARSE(M, LEN, terms, (int) (sizeof(terms) / sizeof(int)), c); \
+}
+
+DEFINE_FIELD_CTX_REDUCE(163, 3, 7, 6, 3, 0)
+DEFINE_FIELD_CTX_REDUCE(233, 4, 74, 0)
+DEFINE_FIELD_CTX_REDUCE(283, 5, 12, 7, 5, 0)
+DEFINE_FIELD_CTX_REDUCE(409, 7, 87, 0)
+DEFINE_FIELD_CTX_REDUCE(571, 9, 10, 5, 2, 0)
+
+/* Schoolbook product of LEN-word polynomials into 2*LEN words, CLMUL64 is a 64x64 kernel */
+#define FIELD_PRODUCT_WORDS(LEN, CLMUL64, a, b, p) do { \
+	for(int i_ = 0; i_ < 2*(LEN); i_++) { \
+		(p)[i_] = 0; \
+	} \
+	for(int i_ = 0; i_ < (LEN); i_++) { \
+		for(int j_ = 0; j_ < (LEN); j_++) { \
+			uint64_t w_[2]; \
+			CLMUL64((a)[i_], (b)[j_], w_); \
+			(p)[i_ + j_] ^= w_[0]; \
+			(p)[i_ + j_ + 1] ^= w_[1]; \
+		} \
+	} \
+} while(0)
+
+/*
+* Multiplication and squaring with the element length fixed at compile time,
+* so that the loops are unrolled. The reduction goes through the context.
+*/
+#define DEFINE_FIELD_CTX_WORDS(LEN) \
+TARGET_PCLMUL \
+void field_ctx_mult_words##LEN##_clmul(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) { \
+	uint64_t p[2*(LEN)]; \
+	FIELD_PRODUCT_WORDS(LEN, clmul64_pclmul, a, b, p); \
+	ctx->reduce(ctx, p); \
+	memcpy(c, p, sizeof(uint64_t)*(LEN)); \
+} \
+void field_ctx_mult_words##LEN##_software(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) { \
+	uint64_t p[2*(LEN)]; \
+	FIELD_PRODUCT_WORDS(LEN, clmul64_holes, a, b, p); \
+	ctx->reduce(ctx, p); \
+	memcpy(c, p, sizeof(uint64_t)*(LEN)); \
+} \
+void field_ctx_square_words##LEN(field_t * ctx, uint64_t * a, uint64_t * c) { \
+	uint64_t p[2*(LEN)]; \
+	for(int i = 0; i < (LEN); i++) { \
+		p[2*i] = spread_bits32(a[i]); \
+		p[2*i+1] = spread_bits32(a[i] >> 32); \
+	} \
+	ctx->reduce(ctx, p); \
+	memcpy(c, p, sizeof(uint64_t)*(LEN)); \
+}
+
+DEFINE_FIELD_CTX_WORDS(2)
+DEFINE_FIELD_CTX_WORDS(3)
+DEFINE_FIELD_CTX_WORDS(4)
+DEFINE_FIELD_CTX_WORDS(5)
+DEFINE_FIELD_CTX_WORDS(6)
+DEFINE_FIELD_CTX_WORDS(7)
+DEFINE_FIELD_CTX_WORDS(8)
+DEFINE_FIELD_CTX_WORDS(9)
+
+void (*field_ctx_mult_clmul_kernels[FIELD_MAX_WORDS + 1])(field_t *, uint64_t *, uint64_t *, uint64_t *) = {
+	NULL, NULL, field_ctx_mult_words2_clmul, field_ctx_mult_words3_clmul, field_ctx_mult_words4_clmul,
+	field_ctx_mult_words5_clmul, field_ctx_mult_words6_clmul, field_ctx_mult_words7_clmul,
+	field_ctx_mult_words8_clmul, field_ctx_mult_words9_clmul
+};
+
+void (*field_ctx_mult_software_kernels[FIELD_MAX_WORDS + 1])(field_t *, uint64_t *, uint64_t *, uint64_t *) = {
+	NULL, NULL, field_ctx_mult_words2_software, field_ctx_mult_words3_software, field_ctx_mult_words4_software,
+	field_ctx_mult_words5_software, field_ctx_mult_words6_software, field_ctx_mult_words7_software,
+	field_ctx_mult_words8_software, field_ctx_mult_words9_software
+};
+
+void (*field_ctx_square_kernels[FIELD_MAX_WORDS + 1])(field_t *, uint64_t *, uint64_t *) = {
+	NULL, NULL, field_ctx_square_words2, field_ctx_square_words3, field_ctx_square_words4,
+	field_ctx_square_words5, field_ctx_square_words6, field_ctx_square_words7,
+	field_ctx_square_words8, field_ctx_square_words9
+};
+
+/*
+* Alg 2.48 on len-word polynomials, the state is on the stack and swapped by pointer.
+* Preconditions:
+*   a is nonzero, of max degree m - 1
+*/
+void field_ctx_inv_euclid(field_t * ctx, uint64_t * a, uint64_t * c) {
+	int len = ctx->len;
+	uint64_t buf[4][FIELD_MAX_WORDS];
+	uint64_t * u = buf[0];
+	uint64_t * v = buf[1];
+	uint64_t * g1 = buf[2];
+	uint64_t * g2 = buf[3];
+	memcpy(u, a, sizeof(uint64_t)*len);
+	memcpy(v, ctx->f, sizeof(uint64_t)*len);
+	clear_array(g1, len);
+	clear_array(g2, len);
 	g1[0] = 1;
-	g1[1] = 0;
-	uint64_t * g2 = malloc(2*sizeof(uint64_t));
-	g2[0] = g2[1] = 0;
 	
-	/* Step 3 */
-	while (!(u[0] == 1 && u[1] == 0)) {
-		/* Step 3.1 */
+	int deg_u = degree_words(u, len);
+	int deg_v = ctx->m;
+	while(deg_u > 0) {
 		int j = deg_u - deg_v;
-		
-		/* Step 3.2 */
 		if(j < 0) {
-			//swap_arrays(u, v, 2);
 			uint64_t * tmp = u;
 			u = v;
 			v = tmp;
-			
 			tmp = g1;
 			g1 = g2;
 			g2 = tmp;
-			//swap_arrays(g1, g2, 2);
-			
+			int tmp_deg = deg_u;
+			deg_u = deg_v;
+			deg_v = tmp_deg;
 			j = -j;
-			
-			int temp8 = deg_u;
-			deg_u =  deg_v;
-			deg_v = temp8;
-		}
-		/* Step 3.3 */
-		uint64_t shift_polynomial[2];
-		/* shift v */
-		memcpy(shift_polynomial, v, sizeof(uint64_t)*2);
-		if(j != 0) {
-			if(j > 63) {
-				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
-				shift_polynomial[0] = 0;
-			} else {
-				uint64_t carry = shift_polynomial[0] >> (64 - j);
-				shift_polynomial[0] <<= j;
-				shift_polynomial[1] <<= j;
-				shift_polynomial[1] |= carry;
-			}
-		}
-		//lshift_polynomial_optimized(shift_polynomial, j);
-		u[0] = shift_polynomial[0] ^ u[0];
-		u[1] = shift_polynomial[1] ^ u[1];
-		//add(shift_polynomial, u, u);
-		
-		/* Calculating degree of u */
-		if(u[1] == 0) {
-			if(u[0] == 0) {
-				deg_u = 0;
-			} else {
-				int upper = u[0] >> 32;
-				if(upper == 0) {
-					deg_u = 31 - __builtin_clz(u[0]);
-				} else {
-					deg_u = 63 - __builtin_clz(upper);
-				}
-			}
-		} else {
-			int upper = u[1] >> 32;
-			if(upper == 0) {
-				deg_u = 95 - __builtin_clz(u[1]);
-			} else {
-				deg_u = 127 - __builtin_clz(upper);
-			}
 		}
-		//deg_u = degree_len2(u);
-		
-		/*Step 3.4 */
-		/*shift g2 */
-		memcpy(shift_polynomial, g2, sizeof(uint64_t)*2);
-		if(j != 0) {
-			if(j > 63) {
-				shift_polynomial[1] = shift_polynomial[0] << (j - 64);
-				shift_polynomial[0] = 0;
-			} else {
-				uint64_t carry = shift_polynomial[0] >> (64 - j);
-				shift_polynomial[0] <<= j;
-				shift_polynomial[1] <<= j;
-				shift_polynomial[1] |= carry;
-			}
+		xor_shifted_array(u, v, j, len);
+		xor_shifted_array(g1, g2, j, len);
+		deg_u = degree_words(u, len);
+	}
+	memcpy(c, g1, sizeof(uint64_t)*len);
+}
+
+/* The context of GF(2^127) forwards to the fused kernels of this file */
+void field_ctx_mult_127(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) {
+	(void) ctx;
+	field_mul(a, b, c);
+}
+
+void field_ctx_square_127(field_t * ctx, uint64_t * a, uint64_t * c) {
+	(void) ctx;
+	field_square(a, c);
+}
+
+void field_ctx_reduce_127(field_t * ctx, uint64_t * c) {
+	(void) ctx;
+	reduction_trinomial(c);
+}
+
+void field_ctx_inv_127(field_t * ctx, uint64_t * a, uint64_t * c) {
+	(void) ctx;
+	inv_itoh_tsujii(a, c);
+}
+
+/* The kernels instantiated for the element length, for any modulus */
+void field_ctx_set_word_kernels(field_t * ctx) {
+	if(cpu_supports_pclmul()) {
+		ctx->mult = field_ctx_mult_clmul_kernels[ctx->len];
+	} else {
+		ctx->mult = field_ctx_mult_software_kernels[ctx->len];
+	}
+	ctx->square = field_ctx_square_kernels[ctx->len];
+	ctx->inv = field_ctx_inv_euclid;
+}
+
+bool field_ctx_has_modulus(field_t * ctx, int m, const int * terms, int num_terms) {
+	return ctx->m == m && ctx->num_terms == num_terms
+		&& memcmp(ctx->terms, terms, sizeof(int)*num_terms) == 0;
+}
+
+/*
+* The kernels of the sparse reduction, selected by f. GF(2^127) forwards
+* to the fused kernels and the NIST moduli get their specialized reduction.
+*/
+void field_ctx_set_sparse_kernels(field_t * ctx) {
+	const int terms_127[2] = {63, 0};
+	const int terms_163[4] = {7, 6, 3, 0};
+	const int terms_233[2] = {74, 0};
+	const int terms_283[4] = {12, 7, 5, 0};
+	const int terms_409[2] = {87, 0};
+	const int terms_571[4] = {10, 5, 2, 0};
+	if(field_ctx_has_modulus(ctx, 127, terms_127, 2)) {
+		ctx->mult = field_ctx_mult_127;
+		ctx->square = field_ctx_square_127;
+		ctx->reduce = field_ctx_reduce_127;
+		ctx->inv = field_ctx_inv_127;
+		return;
+	}
+	field_ctx_set_word_kernels(ctx);
+	if(field_ctx_has_modulus(ctx, 163, terms_163, 4)) {
+		ctx->reduce = field_ctx_reduce_163;
+	} else if(field_ctx_has_modulus(ctx, 233, terms_233, 2)) {
+		ctx->reduce = field_ctx_reduce_233;
+	} else if(field_ctx_has_modulus(ctx, 283, terms_283, 4)) {
+		ctx->reduce = field_ctx_reduce_283;
+	} else if(field_ctx_has_modulus(ctx, 409, terms_409, 2)) {
+		ctx->reduce = field_ctx_reduce_409;
+	} else if(field_ctx_has_modulus(ctx, 571, terms_571, 4)) {
+		ctx->reduce = field_ctx_reduce_571;
+	} else {
+		ctx->reduce = field_ctx_reduce_sparse;
+	}
+}
+
+/* Barrett reduction, two multiplications for any modulus of degree m <= 128 */
+
+/*
+* out = w div z^s as two words, branch-free also for s % 64 = 0.
+* w must have words up to index s/64 + 2.
+*/
+#define RSHIFT_TO_2_WORDS(w, s, out) do { \
+	int qw_ = (s) / 64; \
+	int bw_ = (s) % 64; \
+	(out)[0] = ((w)[qw_] >> bw_) | (((w)[qw_+1] << 1) << (63 - bw_)); \
+	(out)[1] = ((w)[qw_+1] >> bw_) | (((w)[qw_+2] << 1) << (63 - bw_)); \
+} while(0)
+
+/*
+* mu = z^(2m) div f by long division, stored without its leading z^m.
+* Also stores g = f - z^m, so that both products are 2x2 words.
+*/
+void barrett_precompute(field_t * ctx) {
+	int m = ctx->m;
+	uint64_t rem[5] = {0, 0, 0, 0, 0};
+	uint64_t mu[3] = {0, 0, 0};
+	rem[(2*m) / 64] = (uint64_t) 1 << ((2*m) % 64);
+	for(int i = 2*m; i >= m; i--) {
+		if((rem[i / 64] >> (i % 64)) & 1) {
+			xor_shifted_array(rem, ctx->f, i - m, 5);
+			mu[(i - m) / 64] ^= (uint64_t) 1 << ((i - m) % 64);
 		}
-		//lshift_polynomial_optimized(shift_polynomial, j);
-		g1[0] = shift_polynomial[0] ^ g1[0];
-		g1[1] = shift_polynomial[1] ^ g1[1];
-		//add(shift_polynomial, g1, g1);
 	}
-	/* Step 4 */
-	inv_a[0] = g1[0];
-	inv_a[1] = g1[1];
-	free(u);
-	free(v);
-	free(g1);
-	free(g2);
+	mu[m / 64] ^= (uint64_t) 1 << (m % 64);
+	ctx->barrett_mu[0] = mu[0];
+	ctx->barrett_mu[1] = mu[1];
+	ctx->barrett_g[0] = ctx->f[0];
+	ctx->barrett_g[1] = ctx->f[1];
+	if(m < 128) {
+		ctx->barrett_g[1] ^= (uint64_t) 1 << (m % 64);
+	}
 }
 
 /*
-* Alg 2.49 - Binary Inversion Algorithm
+* With c = c1*z^m + c0 of degree < 2m, the quotient by f is exactly
+* q = (c1*mu) div z^m = c1 + (c1*(mu - z^m)) div z^m, and c mod f = (c0 + q*g) mod z^m.
+* MULT is a 128x128 bit polynomial multiplication.
+*/
+#define FIELD_REDUCE_BARRETT(MULT, ctx, c) do { \
+	int m_ = (ctx)->m; \
+	uint64_t c1_[2]; \
+	uint64_t p_[5]; \
+	uint64_t q_[2]; \
+	RSHIFT_TO_2_WORDS(c, m_, c1_); \
+	MULT(c1_, (ctx)->barrett_mu, p_); \
+	p_[4] = 0; \
+	RSHIFT_TO_2_WORDS(p_, m_, q_); \
+	q_[0] ^= c1_[0]; \
+	q_[1] ^= c1_[1]; \
+	MULT(q_, (ctx)->barrett_g, p_); \
+	(c)[0] ^= p_[0]; \
+	(c)[1] ^= p_[1]; \
+	if(m_ < 128) { \
+		(c)[1] &= ((uint64_t) 1 << (m_ % 64)) - 1; \
+	} \
+	for(int i_ = 2; i_ < 2*(ctx)->len; i_++) { \
+		(c)[i_] = 0; \
+	} \
+} while(0)
+
+/*
 * Preconditions:
-* 	Arrays have length 2
-*	a has max degree 126
+*   c has length 2*ctx->len and max degree 2m - 2
 */
-void inv_binary(uint64_t * a, uint64_t * inv_a) {
-	/* Step 1 */
-	uint64_t u[2];
-	uint64_t v[2];
-	memcpy(u, a, sizeof(uint64_t)*2);
-	memcpy(v, f, sizeof(uint64_t)*2);
-	
-	/* Step 2 */
-	uint64_t g1[2] = {1, 0 };
-	uint64_t g2[2] = {0, 0 };
-	
-	/* Step 3 */
-	while(!(u[0] == 1 && u[1] == 0) && !(v[0] == 1 && v[1] == 0)) {
-		/* Step 3.1 */
-		while(u[0] % 2 == 0) {
-			rshift_polynomial(u, 2);
-			if(g1[0] % 2 == 1) {
-				add(f, g1, g1);
-			}
-			rshift_polynomial(g1, 2);
+TARGET_PCLMUL
+void field_ctx_reduce_barrett_clmul(field_t * ctx, uint64_t * c) {
+	FIELD_REDUCE_BARRETT(mult_polynomial_clmul, ctx, c);
+}
+
+void field_ctx_reduce_barrett_software(field_t * ctx, uint64_t * c) {
+	FIELD_REDUCE_BARRETT(mult_polynomial_holes, ctx, c);
+}
+
+/*
+* Preconditions:
+*   terms are unique and in decreasing order, with 0 as the last term
+*/
+bool field_init(field_t * ctx, int m, int * terms, int num_terms) {
+	int len = m / 64 + 1;
+	if(len < 2 || len > FIELD_MAX_WORDS || num_terms > FIELD_MAX_TERMS) {
+		return 0;
+	}
+	for(int i = 0; i < num_terms; i++) {
+		if(terms[i] > m - 64) {
+			return 0;
 		}
-		/* Step 3.2 */
-		while(v[0] % 2 == 0) {
-			rshift_polynomial(v, 2);
-			if(g2[0] % 2 == 1) {
-				add(f, g2, g2);
-			}
-			rshift_polynomial(g2, 2);
+	}
+	ctx->m = m;
+	ctx->len = len;
+	ctx->num_terms = num_terms;
+	memcpy(ctx->terms, terms, sizeof(int)*num_terms);
+	clear_array(ctx->f, FIELD_MAX_WORDS);
+	ctx->f[m / 64] = (uint64_t) 1 << (m % 64);
+	for(int i = 0; i < num_terms; i++) {
+		ctx->f[terms[i] / 64] ^= (uint64_t) 1 << (terms[i] % 64);
+	}
+	
+	ctx->reduction = FIELD_REDUCTION_SPARSE;
+	field_ctx_set_sparse_kernels(ctx);
+	return 1;
+}
+
+/*
+* Preconditions:
+*   f has length 3, degree m and is irreducible
+*/
+bool field_init_barrett(field_t * ctx, int m, uint64_t * f) {
+	if(m < 64 || m > 128) {
+		return 0;
+	}
+	ctx->m = m;
+	ctx->len = m / 64 + 1;
+	ctx->num_terms = 0;
+	clear_array(ctx->f, FIELD_MAX_WORDS);
+	memcpy(ctx->f, f, sizeof(uint64_t)*ctx->len);
+	return field_set_reduction(ctx, FIELD_REDUCTION_BARRETT);
+}
+
+bool field_set_reduction(field_t * ctx, int reduction) {
+	if(reduction == FIELD_REDUCTION_BARRETT) {
+		if(ctx->m > 128) {
+			return 0;
 		}
-		/* Step 3.3 */
-		if(u[1] > v[1] || (u[1] == v[1] && u[0] > v[0])) {
-			add(v, u, u);
-			add(g2, g1, g1);
+		barrett_precompute(ctx);
+		field_ctx_set_word_kernels(ctx);
+		if(cpu_supports_pclmul()) {
+			ctx->reduce = field_ctx_reduce_barrett_clmul;
 		} else {
-			add(u, v, v);
-			add(g1, g2, g2);
+			ctx->reduce = field_ctx_reduce_barrett_software;
 		}
-	}
-	/* Step 4 */
-	if(u[0] == 1 && u[1] == 0) {
-		swap_arrays(inv_a, g1, 2);
 	} else {
-		swap_arrays(inv_a, g2, 2);
+		if(ctx->num_terms == 0) {
+			return 0;
+		}
+		field_ctx_set_sparse_kernels(ctx);
+	}
+	ctx->reduction = reduction;
+	return 1;
+}
+
+int has_fields_precomputed = 0;
+
+field_t field_127;
+field_t field_163;
+field_t field_233;
+field_t field_283;
+field_t field_409;
+field_t field_571;
+
+void fields_precompute() {
+	int terms_127[2] = {63, 0};
+	int terms_163[4] = {7, 6, 3, 0};
+	int terms_233[2] = {74, 0};
+	int terms_283[4] = {12, 7, 5, 0};
+	int terms_409[2] = {87, 0};
+	int terms_571[4] = {10, 5, 2, 0};
+	field_init(&field_127, 127, terms_127, 2);
+	field_init(&field_163, 163, terms_163, 4);
+	field_init(&field_233, 233, terms_233, 2);
+	field_init(&field_283, 283, terms_283, 4);
+	field_init(&field_409, 409, terms_409, 2);
+	field_init(&field_571, 571, terms_571, 4);
+	has_fields_precomputed = 1;
+}
+
+field_t * field_get(int m) {
+	if(!has_fields_precomputed) {
+		fields_precompute();
+	}
+	switch(m) {
+		case 127: return &field_127;
+		case 163: return &field_163;
+		case 233: return &field_233;
+		case 283: return &field_283;
+		case 409: return &field_409;
+		case 571: return &field_571;
+		default: return NULL;
+	}
+}
+
+void field_ctx_add(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) {
+	for(int i = 0; i < ctx->len; i++) {
+		c[i] = a[i] ^ b[i];
+	}
+}
+
+void field_ctx_mult(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) {
+	ctx->mult(ctx, a, b, c);
+}
+
+void field_ctx_square(field_t * ctx, uint64_t * a, uint64_t * c) {
+	ctx->square(ctx, a, c);
+}
+
+void field_ctx_reduce(field_t * ctx, uint64_t * c) {
+	ctx->reduce(ctx, c);
+}
+
+void field_ctx_inv(field_t * ctx, uint64_t * a, uint64_t * c) {
+	ctx->inv(ctx, a, c);
+}
+
+void field_ctx_rand_element(field_t * ctx, uint64_t * a) {
+	for(int i = 0; i < ctx->len; i++) {
+		a[i] = ((uint64_t) rand() << 62) ^ ((uint64_t) rand() << 31) ^ rand();
 	}
+	a[ctx->len - 1] &= ((uint64_t) 1 << (ctx->m % 64)) - 1;
 }
 
 /*
@@ -1025,9 +3493,9 @@ void main() {*/
 	print_array(result_mult_lrcomb, 4);
 	print_polynomial(result_mult_lrcomb, 4);
 	
-	printf("\nLeft-to-right comb mult d*r, w = 16\n");
+	printf("\nLeft-to-right comb mult d*r, w = 8\n");
 	uint64_t result_mult_lrcombwindow[4];
-	mult_polynomial_lrcomb_window(d,r,result_mult_lrcombwindow, 16);
+	mult_polynomial_lrcomb_window(d,r,result_mult_lrcombwindow, 8);
 	print_array(result_mult_lrcombwindow, 4);
 	print_polynomial(result_mult_lrcombwindow, 4);
 	
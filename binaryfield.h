@@ -1,3 +1,6 @@
+#ifndef BINARYFIELD_H
+#define BINARYFIELD_H
+
 #include <inttypes.h>
 #include <stdbool.h> 
 #include <stdio.h>
@@ -37,6 +40,38 @@ void mult_polynomial_rlcomb(uint64_t * a, uint64_t * b, uint64_t * c);
 */
 void mult_polynomial_lrcomb(uint64_t * a, uint64_t * b, uint64_t * c);
 
+/*
+* Alg 2.36 Left-to-right comb method for polynomial multiplication with window
+* Uses the specialized mult_polynomial_lrcomb_w* for w = 2, 3, 4, 5, 6 and 8.
+* A width outside 1..8 is rejected and the product is computed with w = 8.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+* 	1 <= w <= 8
+*/
+void mult_polynomial_lrcomb_window(uint64_t * a, uint64_t * b, uint64_t * c, int w);
+
+/*
+* Alg 2.36 Left-to-right comb with window width fixed at compile time.
+* The table holds 2^w entries of 3 words, w = 2 uses 96 bytes and w = 8 uses 6 KiB.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*/
+void mult_polynomial_lrcomb_w2(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_polynomial_lrcomb_w3(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_polynomial_lrcomb_w4(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_polynomial_lrcomb_w5(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_polynomial_lrcomb_w6(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void mult_polynomial_lrcomb_w8(uint64_t * a, uint64_t * b, uint64_t * c);
+
 /*
 * Alg 2.36 Left-to-right comb method for polynomial multiplication with window size 8
 * Note that it does not reduce the result.
@@ -46,6 +81,283 @@ void mult_polynomial_lrcomb(uint64_t * a, uint64_t * b, uint64_t * c);
 */
 void mult_polynomial_lrcomb_window8(uint64_t * a, uint64_t * b, uint64_t * c);
 
+/*
+* A multiplicand with its comb window table, u*b for all u of degree < w.
+* Entries are 3 words since b has max degree 126 and u max degree 7.
+* Only the first 2^w entries are built and read, so the working set is
+* 384 bytes for w = 4 and 6 KiB for w = 8.
+*/
+typedef struct prepared_multiplicand_st {
+	int w;
+	uint64_t table[256][3];
+} prepared_multiplicand_t;
+
+/*
+* Builds the window table for b, to be reused with mult_polynomial_prepared.
+* Preconditions:
+*   b is of max degree 126, length 2
+*   w is 4 or 8
+*/
+void prepare_multiplicand(uint64_t * b, int w, prepared_multiplicand_t * prepared);
+
+/*
+* Left-to-right comb multiplication a*b with b prepared by prepare_multiplicand.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a is of max degree 126, length 2
+*/
+void mult_polynomial_prepared(uint64_t * a, prepared_multiplicand_t * prepared, uint64_t * c);
+
+/*
+* Accumulator for sums of products, the unreduced 4-word products are added
+* and reduced once in accumulator_finalize, instead of once per term.
+*/
+typedef struct accumulator_st {
+	uint64_t c[4];
+} accumulator_t;
+
+/*
+* Sets the accumulator to zero.
+*/
+void accumulator_init(accumulator_t * acc);
+
+/*
+* acc += a*b, without reducing.
+* Preconditions:
+*   a,b are of max degree 126, length 2
+*/
+void accumulator_mult_add(accumulator_t * acc, uint64_t * a, uint64_t * b);
+
+/*
+* c = acc mod f. The accumulator is left unchanged and can keep accumulating.
+* Preconditions:
+*   c has length 2
+*/
+void accumulator_finalize(accumulator_t * acc, uint64_t * c);
+
+/*
+* c = sum of a_i*b_i mod f, with a single reduction.
+* Also covers polynomial evaluation and polynomial MACs (sum of m_i*h^i)
+* when b holds precomputed powers.
+* Preconditions:
+*   a, b have length 2n, element i is at index 2i
+*   elements of a, b have max degree 126
+*   c has length 2
+*/
+void inner_product(uint64_t * a, uint64_t * b, uint64_t n, uint64_t * c);
+
+/*
+* Bitsliced field multiplication of 64 pairs at once, c_i = a_i * b_i mod f.
+* The elements are transposed into bit-planes of uint64_t, multiplied and
+* reduced with AND/XOR only, and transposed back. No table lookups and no
+* data-dependent branches.
+* Note that the result is reduced.
+* Preconditions:
+*   a, b, c have length 128, element i is at index 2i
+*   elements of a, b have max degree 126
+*/
+void mult_bitsliced64(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Karatsuba polynomial multiplication, iterative down to 8x8 bit table lookups
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 127, length 2
+*/
+void mult_karatsuba(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Portable carry-less multiplication, Karatsuba over 64x64 products computed
+* with the integer multiplier on operands masked to every fourth bit ("holes").
+* Branch-free and table-free, no ISA-specific intrinsics.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 127, length 2
+*/
+void mult_polynomial_holes(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Carry-less multiplication with PCLMULQDQ, Karatsuba over the two 64-bit limbs
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*   cpu_supports_pclmul() is true
+*/
+void mult_polynomial_clmul(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Polynomial multiplication with the fastest kernel the CPU supports,
+* mult_polynomial_clmul if available, else mult_polynomial_holes.
+* Note that it does not reduce the result.
+* Preconditions:
+*   c is of length 4
+*   a,b are of max degree 126, length 2
+*/
+void mult_polynomial(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Field multiplication c = a*b mod f, fused with the reduction.
+* The high product words are folded with z^127 = z^63 + 1 in registers,
+* with PCLMULQDQ if available, else the portable holes multiply.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a,b are of max degree 127
+*/
+void field_mul(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/* The individual field_mul kernels, field_mul dispatches between them */
+void field_mul_clmul(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_mul_software(uint64_t * a, uint64_t * b, uint64_t * c);
+
+/*
+* Multiplication by a monomial, c = a*z^k mod f for any k.
+* k <= 127 is a word shift and a trinomial fold. Moderate k folds in
+* z^127 = z^63 + 1 once per 127 bits of k. Larger k shifts by the lowest
+* 6-bit digit of k and multiplies by z^(d*64^i) from a cached 11 KiB table
+* for each other nonzero digit d, at most 10 field_mul.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void mult_monomial(uint64_t * a, uint64_t k, uint64_t * c);
+
+/*
+* Multiplication by a sparse polynomial given as a list of exponents,
+* c = a * (z^indices[0] + ... + z^indices[len_i - 1]) mod f.
+* One word shift per term and a single trinomial fold.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*   indices are unique and at most 127
+*/
+void mult_sparse(uint64_t * a, uint64_t * indices, int len_i, uint64_t * c);
+
+/*
+* Batched field multiplication, c_i = a_i * b_i mod f for n independent pairs.
+* Uses VPCLMULQDQ on four elements per 512-bit register when supported,
+* else VPCLMULQDQ on two elements per 256-bit register without AVX-512,
+* else PCLMULQDQ one element at a time, else field_mul.
+* Note that the result is reduced.
+* Preconditions:
+*   a, b, c have length 2n, element i is at index 2i
+*   elements of a, b have max degree 126
+*/
+void mult_batch(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+/* The individual batch kernels, mult_batch dispatches between them */
+void mult_batch_vpclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+void mult_batch_vpclmul_avx2(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+void mult_batch_pclmul(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+void mult_batch_generic(uint64_t * a, uint64_t * b, uint64_t * c, uint64_t n);
+
+/*
+* Field squaring c = a^2 mod f, fused with the reduction.
+* The bits of a are spread with PCLMULQDQ(a, a) if available, else PDEP,
+* else masked shifts, and folded with z^127 = z^63 + 1 in registers.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void field_square(uint64_t * a, uint64_t * c);
+
+/* The individual field_square kernels, field_square dispatches between them */
+void field_square_clmul(uint64_t * a, uint64_t * c);
+
+void field_square_pdep(uint64_t * a, uint64_t * c);
+
+void field_square_software(uint64_t * a, uint64_t * c);
+
+/*
+* Squares n elements, c_i = a_i^2 mod f.
+* Uses AVX2 on two elements per 256-bit register when supported,
+* spreading nibbles with PSHUFB, else field_square.
+* Note that the result is reduced.
+* Preconditions:
+*   a, c have length 2n, element i is at index 2i
+*   elements of a have max degree 127
+*/
+void field_square_array(uint64_t * a, uint64_t * c, uint64_t n);
+
+/* The individual array kernels, field_square_array dispatches between them */
+void field_square_array_avx2(uint64_t * a, uint64_t * c, uint64_t n);
+
+void field_square_array_generic(uint64_t * a, uint64_t * c, uint64_t n);
+
+/*
+* Multi-squaring c = a^(2^k) mod f.
+* Small k squares k times with field_square, larger k applies the linear map
+* of k squarings with 16 byte-indexed lookups into a 64 KiB table, which is
+* built on the first call with that k and cached.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void field_multisquare(uint64_t * a, uint64_t k, uint64_t * c);
+
+/* The two methods, field_multisquare picks between them by k */
+void field_multisquare_iterated(uint64_t * a, uint64_t k, uint64_t * c);
+
+void field_multisquare_table(uint64_t * a, uint64_t k, uint64_t * c);
+
+/*
+* Square root c = sqrt(a) mod f, in constant time.
+* Since f is a trinomial, sqrt(a) = even(a) + (z^64 + z^32)*odd(a) where
+* even(a), odd(a) hold the even and odd coefficients of a. They are
+* extracted with PEXT if available, else with masked shifts.
+* Note that the result is reduced.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void field_sqrt(uint64_t * a, uint64_t * c);
+
+/* The individual field_sqrt kernels, field_sqrt dispatches between them */
+void field_sqrt_pext(uint64_t * a, uint64_t * c);
+
+void field_sqrt_software(uint64_t * a, uint64_t * c);
+
+/*
+* Redundant representation for chained arithmetic. An element is any
+* polynomial of max degree 127 congruent to it mod f, so bit 127 may be set.
+* field_mul_lazy and field_square_lazy fold with z^128 = z^64 + z and skip
+* the final fold of bit 127. field_canonicalize gives the reduced element,
+* to be used on output, serialization and comparison, field_equal compares
+* two elements in either representation. field_mul, field_square and
+* field_square_array also accept inputs of degree 127 and return reduced results.
+* Preconditions:
+*   Arrays have length 2
+*   a,b are of max degree 127
+*/
+void field_mul_lazy(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_square_lazy(uint64_t * a, uint64_t * c);
+
+void field_canonicalize(uint64_t * a, uint64_t * c);
+
+bool field_equal(uint64_t * a, uint64_t * b);
+
+/* The individual lazy kernels, field_mul_lazy and field_square_lazy dispatch between them */
+void field_mul_lazy_clmul(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_mul_lazy_software(uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_square_lazy_clmul(uint64_t * a, uint64_t * c);
+
+void field_square_lazy_software(uint64_t * a, uint64_t * c);
+
 /*
  * Alg 2.39 Polynomial squaring
  *
@@ -66,6 +378,17 @@ void square_polynomial(uint64_t * a, uint64_t * c);
  */
 void reduction_generic(uint64_t * c);
 
+/*
+ * Modular reduction for f = z^127 + z^63 + 1 with word shifts and XORs,
+ * branch-free. reduction_generic remains the table-driven fallback.
+ *
+ * Reduces c mod f in place, c[2] and c[3] are cleared.
+ * Precondition:
+ * 	c has at most degree 253
+ *		c has length 4
+ */
+void reduction_trinomial(uint64_t * c);
+
 /*  Alg 2.47 Extended Euclidean algorithm for binary polynomials
  * Output is d = gcd(a,b), and g,h so that ag + bh = d
  * Preconditions:
@@ -90,6 +413,272 @@ void inv_euclid(uint64_t * a, uint64_t * inv_a);
 */
 void inv_binary(uint64_t * a, uint64_t * inv_a);
 
+/*
+* Alg 2.50 - Almost Inverse Algorithm, b = a^-1 * z^k of max degree 127
+* with k <= 254. Returns k.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126 and is nonzero
+*/
+int almost_inverse(uint64_t * a, uint64_t * b);
+
+/*
+* Inversion with almost_inverse, a^-1 = b * z^-k with one field_mul
+* by a precomputed table entry.
+* The factors of z are removed with __builtin_ctzll a word at a time
+* instead of one bit per iteration as in inv_binary.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 126 and is nonzero
+*/
+void inv_almost_inverse(uint64_t * a, uint64_t * inv_a);
+
+/*
+* c = a*z^-k mod f, up to 63 factors of z per step.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 126
+*/
+void div_monomial(uint64_t * a, int k, uint64_t * c);
+
+/*
+* Division c = b/a, inv_itoh_tsujii_table followed by one field_mul.
+* Not constant time, for secret a use inv_itoh_tsujii and field_mul.
+* Preconditions:
+* 	Arrays have length 2
+*	a,b have max degree 126 and a is nonzero
+*/
+void field_div(uint64_t * b, uint64_t * a, uint64_t * c);
+
+/*
+* Division c = b/a in the binary-inversion family, almost_inverse, one
+* field_mul by b and div_monomial for the factor z^k. It saves the
+* multiplication after inv_almost_inverse, but is slower than field_div.
+* Preconditions:
+* 	Arrays have length 2
+*	a,b have max degree 126 and a is nonzero
+*/
+void field_div_almost_inverse(uint64_t * b, uint64_t * a, uint64_t * c);
+
+/*
+* Field context for GF(2^m) with f(z) = z^m + r(z), r given by its terms.
+* Elements have len = m/64 + 1 words, products 2*len words.
+* The kernels are picked by field_init, the context of GF(2^127) uses the
+* fused kernels above, the others use kernels unrolled for their length.
+*/
+#define FIELD_MAX_WORDS 9
+#define FIELD_MAX_TERMS 8
+
+/* Reduction modes, word shifts per term of a sparse f or Barrett for any f */
+#define FIELD_REDUCTION_SPARSE 0
+#define FIELD_REDUCTION_BARRETT 1
+
+typedef struct field_st {
+	int m;
+	int len;
+	int num_terms;
+	int terms[FIELD_MAX_TERMS];
+	uint64_t f[FIELD_MAX_WORDS];
+	int reduction;
+	uint64_t barrett_mu[2];
+	uint64_t barrett_g[2];
+	void (*mult)(struct field_st * ctx, uint64_t * a, uint64_t * b, uint64_t * c);
+	void (*square)(struct field_st * ctx, uint64_t * a, uint64_t * c);
+	void (*reduce)(struct field_st * ctx, uint64_t * c);
+	void (*inv)(struct field_st * ctx, uint64_t * a, uint64_t * c);
+} field_t;
+
+/*
+* Sets up the context for f(z) = z^m + z^terms[0] + ... + z^terms[num_terms - 1].
+* Returns 0 if the field is not supported, that is len > FIELD_MAX_WORDS
+* or a term above m - 64.
+* Preconditions:
+*   f is irreducible
+*   terms are unique and in decreasing order, with 0 as the last term
+*/
+bool field_init(field_t * ctx, int m, int * terms, int num_terms);
+
+/*
+* Sets up the context for any f of degree 64 <= m <= 128, given as words,
+* with Barrett reduction. For dense moduli, where word shifts per term of f
+* would cost more than the two multiplications of the Barrett reduction.
+* Returns 0 if m is out of range.
+* Preconditions:
+*   f has length 3, degree m and is irreducible
+*/
+bool field_init_barrett(field_t * ctx, int m, uint64_t * f);
+
+/*
+* Switches the reduction of ctx to FIELD_REDUCTION_SPARSE or FIELD_REDUCTION_BARRETT.
+* Barrett needs m <= 128 and sparse needs the terms of f, else returns 0.
+* With Barrett, multiplication and squaring move to the kernels instantiated
+* per length, which go through ctx->reduce. Switching back to sparse selects
+* the same kernels as field_init, the fused ones for GF(2^127) and the
+* specialized reductions for the NIST moduli.
+*/
+bool field_set_reduction(field_t * ctx, int reduction);
+
+/*
+* The context for m = 127 and the NIST fields, m = 163, 233, 283, 409, 571.
+* Returns NULL for any other m. The contexts are shared by all callers, so
+* a caller that wants another reduction should switch a copy of it.
+*/
+field_t * field_get(int m);
+
+/*
+* Field operations through a context.
+* Preconditions:
+*   Elements have length ctx->len and max degree m - 1
+*   The input of field_ctx_reduce has length 2*ctx->len and max degree 2m - 2,
+*   it is reduced in place and the upper ctx->len words are cleared.
+*   The input of field_ctx_inv is nonzero
+*/
+void field_ctx_add(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_ctx_mult(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c);
+
+void field_ctx_square(field_t * ctx, uint64_t * a, uint64_t * c);
+
+void field_ctx_reduce(field_t * ctx, uint64_t * c);
+
+void field_ctx_inv(field_t * ctx, uint64_t * a, uint64_t * c);
+
+/*
+* Generates a random member of the field of ctx.
+* Precondition:
+* 	a has length ctx->len
+*/
+void field_ctx_rand_element(field_t * ctx, uint64_t * a);
+
+/*
+* Itoh-Tsujii inversion, a^-1 = a^(2^127 - 2) with 9 field_mul and 126
+* field_square along the addition chain 1, 2, 3, 6, 12, 15, 30, 60, 63, 126.
+* Runs in constant time: the sequence of operations does not depend on a,
+* and there are no branches or memory addresses that depend on a.
+* Maps 0 to 0.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 127
+*/
+void inv_itoh_tsujii(uint64_t * a, uint64_t * inv_a);
+
+/*
+* The same chain with the multi-squarings of k >= 4 done by the byte tables
+* of field_multisquare. Faster, but NOT constant time, the table addresses
+* depend on a. Only for data that is not secret.
+* Maps 0 to 0.
+* Preconditions:
+* 	Arrays have length 2
+*	a has max degree 127
+*/
+void inv_itoh_tsujii_table(uint64_t * a, uint64_t * inv_a);
+
+/*
+* Constant-time inversion with the divsteps of Bernstein and Yang's safegcd,
+* 253 divsteps in batches of 62. Each batch runs on the low words only and
+* gives a 2x2 transition matrix of polynomials below z^63, which is then
+* applied to the full operands with carry-less multiplies. The number of
+* steps is fixed and the steps use masks instead of branches, so neither
+* the running time nor the memory accesses depend on a.
+* Maps 0 to 0.
+* Preconditions:
+*   Arrays have length 2
+*   a has max degree 127
+*/
+void inv_safegcd(uint64_t * a, uint64_t * inv_a);
+
+/*
+* s <= 62 divsteps on the low words of f and g, f odd, m = {u, v, q, r}
+* with z^s*f' = u*f + v*g and z^s*g' = q*f + r*g. Returns the new delta.
+*/
+int64_t safegcd_divsteps(int64_t delta, uint64_t f, uint64_t g, int s, uint64_t * m);
+
+/* The transition matrix kernels, inv_safegcd dispatches between them */
+void safegcd_transform_clmul(uint64_t * m, uint64_t * x, uint64_t * y, uint64_t * p, uint64_t * t);
+
+void safegcd_transform_software(uint64_t * m, uint64_t * x, uint64_t * y, uint64_t * p, uint64_t * t);
+
+/*
+* Batch inversion with Montgomery's trick, out_i = in_i^-1 for n elements
+* with a single inv_itoh_tsujii and 3 field_mul per element.
+* Zero elements are skipped in the products and map to 0, so they do not
+* spoil the other inverses. Returns the number of zero elements.
+* Preconditions:
+*   in, out have length 2n, element i is at index 2i, in and out do not overlap
+*   elements of in have max degree 126
+*/
+uint64_t batch_invert(uint64_t * in, uint64_t * out, uint64_t n);
+
+/*
+* batch_invert in place, in blocks of 256 elements with a 4 KiB scratch
+* buffer on the stack instead of an n-element output buffer.
+* Preconditions:
+*   a has length 2n, element i is at index 2i
+*   elements of a have max degree 126
+*/
+uint64_t batch_invert_in_place(uint64_t * a, uint64_t n);
+
+/*
+* Inversion of n independent elements, c_i = a_i^-1 with 0 mapped to 0 on
+* its own, for elements that cannot share a batch_invert. With VPCLMULQDQ
+* the chain of inv_itoh_tsujii runs on 8 elements at once, one per 128-bit
+* lane of two 512-bit registers, or of four 256-bit registers without
+* AVX-512. The n % 8 elements after the last block of 8, and every element
+* without VPCLMULQDQ, go through inv_itoh_tsujii one at a time.
+* All paths run in constant time.
+* Preconditions:
+*   a, c have length 2n, element i is at index 2i, a and c may be the same array
+*   elements of a have max degree 127
+*/
+void inv_array(uint64_t * a, uint64_t * c, uint64_t n);
+
+/* The individual inv_array kernels, inv_array dispatches between them */
+void inv_array_vpclmul(uint64_t * a, uint64_t * c, uint64_t n);
+
+void inv_array_vpclmul_avx2(uint64_t * a, uint64_t * c, uint64_t n);
+
+void inv_array_generic(uint64_t * a, uint64_t * c, uint64_t n);
+
+/*
+* Trace Tr(a) = a + a^2 + ... + a^(2^126), which is 0 or 1. It is linear and
+* only Tr(1) = 1 among the basis elements, so it is a test of bit 0
+* (and bit 127 in the redundant representation).
+* Preconditions:
+*   a is of max degree 127, length 2
+*/
+uint64_t field_trace(uint64_t * a);
+
+/*
+* Half-trace H(a) = sum of a^(4^i) for i = 0 ... 63, a GF(2)-linear map
+* applied with 16 lookups in byte-indexed tables, 64 KiB built on first use.
+* Preconditions:
+*   Arrays have length 2
+*   a is of max degree 127
+*/
+void field_halftrace(uint64_t * a, uint64_t * c);
+
+/* Half-trace with 126 field_square, the reference for the tables */
+void field_halftrace_iterated(uint64_t * a, uint64_t * c);
+
+/*
+* Solves x^2 + x = c. Returns 1 and x = H(c) if Tr(c) = 0, the other
+* solution is x + 1. Returns 0 if there is no solution.
+* Preconditions:
+*   Arrays have length 2
+*   c is of max degree 127
+*/
+bool field_solve_quadratic(uint64_t * c, uint64_t * x);
+
+/*
+* field_solve_quadratic on n elements, solvable[i] tells if x_i solves
+* x^2 + x = c_i. Returns the number of solvable elements.
+* Preconditions:
+*   c, x have length 2n, element i is at index 2i
+*   solvable has length n
+*   elements of c have max degree 127
+*/
+uint64_t field_solve_quadratic_batch(uint64_t * c, uint64_t * x, bool * solvable, uint64_t n);
+
 /*
  * Degree of polynomial
  * Precondition:
@@ -124,4 +713,31 @@ void print_array(uint64_t * a, uint32_t len);
   * Precondition:
   * 	a has length 2
   */
- void rand_element(uint64_t * a);
\ No newline at end of file
+ void rand_element(uint64_t * a);
+ 
+ /*
+  * Returns 1 if the CPU supports the PCLMULQDQ instruction, else 0.
+  */
+ bool cpu_supports_pclmul();
+ 
+ /*
+  * Returns 1 if the CPU supports VPCLMULQDQ with AVX-512F/BW, else 0.
+  */
+ bool cpu_supports_vpclmul();
+
+ /*
+  * Returns 1 if the CPU supports VPCLMULQDQ with AVX2, else 0.
+  */
+ bool cpu_supports_vpclmul_avx2();
+ 
+ /*
+  * Returns 1 if the CPU supports the BMI2 instructions, else 0.
+  */
+ bool cpu_supports_bmi2();
+ 
+ /*
+  * Returns 1 if the CPU supports AVX2, else 0.
+  */
+ bool cpu_supports_avx2();
+
+#endif
\ No newline at end of file
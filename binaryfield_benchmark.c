@@ -48,17 +48,107 @@ void print_stats(benchmark_t result) {
 	printf("Min: %" PRIu64 " ns Max: %" PRIu64 " ns\n\n", min, max);
 }
 
+/*
+* For benchmarks where each timed run handles batch_size elements.
+* Reports the cost per element and the throughput.
+*/
+void print_batch_stats(benchmark_t result, uint64_t batch_size) {
+	qsort(result.times, result.num_tests, sizeof(uint64_t), compare_uint64_t);
+	
+	uint64_t sum = 0;
+	for(int i = 0; i < result.num_tests; i++) {
+		sum += result.times[i];
+	}
+	double mean = (double) sum / ((double) result.num_tests * batch_size);
+	double median = (double) result.times[result.num_tests / 2] / batch_size;
+	double min = (double) result.times[0] / batch_size;
+	
+	printf("Benchmark of %s:\n", result.method_name);
+	printf("Num tests: %" PRIu32 " Batch size: %" PRIu64 "\n", result.num_tests, batch_size);
+	printf("Mean: %.2f ns/element\n", mean);
+	printf("Median: %.2f ns/element\n", median);
+	printf("Min: %.2f ns/element\n", min);
+	printf("Throughput: %.2f Melements/s\n\n", 1000.0 / mean);
+}
+
 struct timespec start_time;
 struct timespec stop_time;
 
 clockid_t CLOCK_TYPE = CLOCK_PROCESS_CPUTIME_ID;
 
+#ifdef BENCHMARK_COUNT_ALLOCS
+/*
+* Allocation counting mode. malloc, calloc, realloc and free are interposed
+* and forward to glibc. The allocations made between start_timer and
+* stop_timer are added up, and benchmark_all reports them per timed call.
+*/
+extern void * __libc_malloc(size_t size);
+extern void * __libc_calloc(size_t num, size_t size);
+extern void * __libc_realloc(void * p, size_t size);
+extern void __libc_free(void * p);
+
+uint64_t global_num_allocs = 0;
+uint64_t global_num_frees = 0;
+uint64_t allocs_at_start = 0;
+uint64_t frees_at_start = 0;
+uint64_t timed_allocs = 0;
+uint64_t timed_frees = 0;
+uint64_t timed_calls = 0;
+
+void * malloc(size_t size) {
+	global_num_allocs++;
+	return __libc_malloc(size);
+}
+
+void * calloc(size_t num, size_t size) {
+	global_num_allocs++;
+	return __libc_calloc(num, size);
+}
+
+void * realloc(void * p, size_t size) {
+	global_num_allocs++;
+	return __libc_realloc(p, size);
+}
+
+void free(void * p) {
+	if(p != NULL) {
+		global_num_frees++;
+	}
+	__libc_free(p);
+}
+
+void print_alloc_stats(char * benchmark_name) {
+	double calls = timed_calls > 0 ? (double) timed_calls : 1;
+	printf("Allocations in %s: %.4f allocs and %.4f frees per timed call (%" PRIu64 " calls)\n\n",
+		benchmark_name, timed_allocs / calls, timed_frees / calls, timed_calls);
+	timed_allocs = 0;
+	timed_frees = 0;
+	timed_calls = 0;
+}
+
+#define RUN_BENCHMARK(benchmark) do { \
+	benchmark(); \
+	print_alloc_stats(#benchmark); \
+} while(0)
+#else
+#define RUN_BENCHMARK(benchmark) benchmark()
+#endif
+
 void start_timer() {
+#ifdef BENCHMARK_COUNT_ALLOCS
+	timed_calls++;
+	allocs_at_start = global_num_allocs;
+	frees_at_start = global_num_frees;
+#endif
 	clock_gettime(CLOCK_TYPE, &start_time);
 }
 
 uint64_t stop_timer() {
 	clock_gettime(CLOCK_TYPE, &stop_time);
+#ifdef BENCHMARK_COUNT_ALLOCS
+	timed_allocs += global_num_allocs - allocs_at_start;
+	timed_frees += global_num_frees - frees_at_start;
+#endif
 	return ((uint64_t ) stop_time.tv_sec - (uint64_t) start_time.tv_sec) * 1000000000 + (stop_time.tv_nsec - start_time.tv_nsec);
 }
 
@@ -169,6 +259,670 @@ void benchmark_mult_polynomial_lrcomb_window8() {
 	print_stats(result);
 }
 
+void benchmark_prepare_multiplicand_w(int w, char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t b[2];
+	prepared_multiplicand_t prepared;
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(b);
+		start_timer();
+		prepare_multiplicand(b, w, &prepared);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+void benchmark_prepare_multiplicand() {
+	benchmark_prepare_multiplicand_w(4, "prepare_multiplicand w = 4");
+	benchmark_prepare_multiplicand_w(8, "prepare_multiplicand w = 8");
+}
+
+/* The multiplicand is prepared once, outside the timed region */
+void benchmark_mult_polynomial_prepared_w(int w, char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[4];
+	prepared_multiplicand_t prepared;
+	rand_element(b);
+	prepare_multiplicand(b, w, &prepared);
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		mult_polynomial_prepared(a, &prepared, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+void benchmark_mult_polynomial_prepared() {
+	benchmark_mult_polynomial_prepared_w(4, "mult_polynomial_prepared w = 4");
+	benchmark_mult_polynomial_prepared_w(8, "mult_polynomial_prepared w = 8");
+}
+
+void benchmark_mult_karatsuba() {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[4];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		rand_element(b);
+		start_timer();
+		mult_karatsuba(a, b, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "mult_karatsuba";
+	print_stats(result);
+}
+
+/* Every specialized window width, with the size of its table */
+void benchmark_mult_polynomial_lrcomb_window_sweep() {
+	int widths[6] = {2, 3, 4, 5, 6, 8};
+	void (*kernels[6])(uint64_t *, uint64_t *, uint64_t *) = {
+		mult_polynomial_lrcomb_w2, mult_polynomial_lrcomb_w3, mult_polynomial_lrcomb_w4,
+		mult_polynomial_lrcomb_w5, mult_polynomial_lrcomb_w6, mult_polynomial_lrcomb_w8
+	};
+	
+	for(int k = 0; k < 6; k++) {
+		uint64_t times[global_num_tests];
+		
+		uint64_t a[2];
+		uint64_t b[2];
+		uint64_t c[4];
+		for(int i = 0; i < global_num_tests; i++) {
+			rand_element(a);
+			rand_element(b);
+			start_timer();
+			kernels[k](a, b, c);
+			times[i] = stop_timer();
+		}
+		
+		char method_name[64];
+		sprintf(method_name, "mult_polynomial_lrcomb_w%d (table %d bytes)", widths[k], 
+			(1 << widths[k]) * 3 * (int) sizeof(uint64_t));
+		benchmark_t result;
+		result.num_tests = global_num_tests;
+		result.times = times;
+		result.method_name = method_name;
+		print_stats(result);
+	}
+}
+
+/* The holes kernel next to the comb it replaces on non-CLMUL targets */
+void benchmark_mult_polynomial_holes() {
+	uint64_t times_holes[global_num_tests];
+	uint64_t times_window8[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[4];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		rand_element(b);
+		start_timer();
+		mult_polynomial_holes(a, b, c);
+		times_holes[i] = stop_timer();
+		
+		start_timer();
+		mult_polynomial_lrcomb_window8(a, b, c);
+		times_window8[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times_holes;
+	result.method_name = "mult_polynomial_holes";
+	print_stats(result);
+	
+	result.times = times_window8;
+	result.method_name = "mult_polynomial_lrcomb_window8 (same operands)";
+	print_stats(result);
+}
+
+void benchmark_mult_polynomial_clmul() {
+	if(!cpu_supports_pclmul()) {
+		printf("PCLMULQDQ not supported, skipping mult_polynomial_clmul\n\n");
+		return;
+	}
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[4];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		rand_element(b);
+		start_timer();
+		mult_polynomial_clmul(a, b, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "mult_polynomial_clmul";
+	print_stats(result);
+}
+
+void benchmark_mult_polynomial() {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[4];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		rand_element(b);
+		start_timer();
+		mult_polynomial(a, b, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "mult_polynomial";
+	print_stats(result);
+}
+
+void benchmark_field_mul_kernel(void (*kernel)(uint64_t *, uint64_t *, uint64_t *), char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		rand_element(b);
+		start_timer();
+		kernel(a, b, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+void benchmark_field_mul() {
+	benchmark_field_mul_kernel(field_mul, "field_mul");
+	if(cpu_supports_pclmul()) {
+		benchmark_field_mul_kernel(field_mul_clmul, "field_mul_clmul");
+	}
+	benchmark_field_mul_kernel(field_mul_software, "field_mul_software");
+}
+
+/* Multiplication by r(z) = z^63 + 1 */
+void benchmark_mult_sparse() {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t indices[2] = {0, 63};
+	uint64_t c[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		mult_sparse(a, indices, 2, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "mult_sparse with r(z) = z^63 + 1";
+	print_stats(result);
+}
+
+void benchmark_mult_monomial_k(uint64_t max_k, char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t c[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		uint64_t k = (((uint64_t) rand() << 32) ^ rand()) % max_k;
+		start_timer();
+		mult_monomial(a, k, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+void benchmark_mult_monomial() {
+	benchmark_mult_monomial_k(128, "mult_monomial k <= 127");
+	benchmark_mult_monomial_k(1024, "mult_monomial k < 1024");
+	benchmark_mult_monomial_k(-1, "mult_monomial any k");
+}
+
+int global_batch_size = 1024;
+
+void benchmark_mult_batch_kernel(void (*kernel)(uint64_t *, uint64_t *, uint64_t *, uint64_t),
+		char * method_name) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * a = malloc(2*global_batch_size*sizeof(uint64_t));
+	uint64_t * b = malloc(2*global_batch_size*sizeof(uint64_t));
+	uint64_t * c = malloc(2*global_batch_size*sizeof(uint64_t));
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < global_batch_size; j++) {
+			rand_element(&a[2*j]);
+			rand_element(&b[2*j]);
+		}
+		start_timer();
+		kernel(a, b, c, global_batch_size);
+		times[i] = stop_timer();
+	}
+	free(a);
+	free(b);
+	free(c);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_batch_stats(result, global_batch_size);
+}
+
+void benchmark_mult_batch() {
+	benchmark_mult_batch_kernel(mult_batch, "mult_batch");
+	if(cpu_supports_vpclmul()) {
+		benchmark_mult_batch_kernel(mult_batch_vpclmul, "mult_batch_vpclmul");
+	}
+	if(cpu_supports_vpclmul_avx2()) {
+		benchmark_mult_batch_kernel(mult_batch_vpclmul_avx2, "mult_batch_vpclmul_avx2");
+	}
+	if(cpu_supports_pclmul()) {
+		benchmark_mult_batch_kernel(mult_batch_pclmul, "mult_batch_pclmul");
+	}
+	benchmark_mult_batch_kernel(mult_batch_generic, "mult_batch_generic");
+}
+
+void benchmark_field_square_kernel(void (*kernel)(uint64_t *, uint64_t *), char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t c[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		kernel(a, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+/* The table squaring followed by the bit-serial reduction, for comparison */
+void square_and_reduce_generic(uint64_t * a, uint64_t * c) {
+	uint64_t square[4];
+	square_polynomial(a, square);
+	reduction_generic(square);
+	c[0] = square[0];
+	c[1] = square[1];
+}
+
+void benchmark_field_square() {
+	benchmark_field_square_kernel(field_square, "field_square");
+	if(cpu_supports_pclmul()) {
+		benchmark_field_square_kernel(field_square_clmul, "field_square_clmul");
+	}
+	if(cpu_supports_bmi2()) {
+		benchmark_field_square_kernel(field_square_pdep, "field_square_pdep");
+	}
+	benchmark_field_square_kernel(field_square_software, "field_square_software");
+	benchmark_field_square_kernel(square_and_reduce_generic, "square_polynomial + reduction_generic");
+}
+
+void benchmark_field_square_array_kernel(void (*kernel)(uint64_t *, uint64_t *, uint64_t),
+		char * method_name) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * a = malloc(2*global_batch_size*sizeof(uint64_t));
+	uint64_t * c = malloc(2*global_batch_size*sizeof(uint64_t));
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < global_batch_size; j++) {
+			rand_element(&a[2*j]);
+		}
+		start_timer();
+		kernel(a, c, global_batch_size);
+		times[i] = stop_timer();
+	}
+	free(a);
+	free(c);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_batch_stats(result, global_batch_size);
+}
+
+void benchmark_field_square_array() {
+	benchmark_field_square_array_kernel(field_square_array, "field_square_array");
+	if(cpu_supports_avx2()) {
+		benchmark_field_square_array_kernel(field_square_array_avx2, "field_square_array_avx2");
+	}
+	benchmark_field_square_array_kernel(field_square_array_generic, "field_square_array_generic");
+}
+
+/* Median ns per call over chains of calls, the timer overhead is spread over the chain */
+double multisquare_median_ns(void (*kernel)(uint64_t *, uint64_t, uint64_t *), uint64_t k, int chain) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t a[2];
+	for(int i = 0; i < num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		for(int j = 0; j < chain; j++) {
+			kernel(a, k, a);
+		}
+		times[i] = stop_timer();
+	}
+	qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+	return (double) times[num_tests / 2] / chain;
+}
+
+/* Iterated squaring vs the table for every k, one line per k */
+void benchmark_field_multisquare() {
+	int chain = 100;
+	uint64_t a[2];
+	rand_element(a);
+	printf("Benchmark of field_multisquare, median ns per call:\n");
+	printf("  k  iterated     table  field_multisquare\n");
+	for(uint64_t k = 1; k <= 126; k++) {
+		/* Builds the table for k outside the timing */
+		field_multisquare_table(a, k, a);
+		double iterated = multisquare_median_ns(field_multisquare_iterated, k, chain);
+		double table = multisquare_median_ns(field_multisquare_table, k, chain);
+		double dispatched = multisquare_median_ns(field_multisquare, k, chain);
+		printf("%3" PRIu64 " %9.2f %9.2f %18.2f\n", k, iterated, table, dispatched);
+	}
+	printf("\n");
+}
+
+void benchmark_field_sqrt_kernel(void (*kernel)(uint64_t *, uint64_t *), char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t c[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		kernel(a, c);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+/* The square root as 126 squarings, what it cost before field_sqrt */
+void sqrt_by_squarings(uint64_t * a, uint64_t * c) {
+	field_multisquare_iterated(a, 126, c);
+}
+
+void benchmark_field_sqrt() {
+	benchmark_field_sqrt_kernel(field_sqrt, "field_sqrt");
+	if(cpu_supports_bmi2()) {
+		benchmark_field_sqrt_kernel(field_sqrt_pext, "field_sqrt_pext");
+	}
+	benchmark_field_sqrt_kernel(field_sqrt_software, "field_sqrt_software");
+	benchmark_field_sqrt_kernel(sqrt_by_squarings, "126 field_square");
+}
+
+/* A dependent chain of multiply and square, canonical after every step vs only at the end */
+void benchmark_field_lazy_chain(bool lazy, char * method_name) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t x[2];
+	uint64_t b[2];
+	for(int i = 0; i < num_tests; i++) {
+		rand_element(x);
+		rand_element(b);
+		start_timer();
+		if(lazy) {
+			for(int j = 0; j < global_batch_size; j++) {
+				field_mul_lazy(x, b, x);
+				field_square_lazy(x, x);
+			}
+			field_canonicalize(x, x);
+		} else {
+			for(int j = 0; j < global_batch_size; j++) {
+				field_mul(x, b, x);
+				field_square(x, x);
+			}
+		}
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_batch_stats(result, global_batch_size);
+}
+
+void benchmark_field_lazy() {
+	benchmark_field_lazy_chain(0, "field_mul + field_square chain");
+	benchmark_field_lazy_chain(1, "field_mul_lazy + field_square_lazy chain");
+}
+
+/* Per element cost of 64 products, bitsliced vs window8 + reduction_generic */
+void benchmark_mult_bitsliced64() {
+	int num_tests = global_num_tests / 10;
+	uint64_t times_bitsliced[num_tests];
+	uint64_t times_window8[num_tests];
+	
+	uint64_t a[128];
+	uint64_t b[128];
+	uint64_t c[128];
+	uint64_t prod[4];
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < 64; j++) {
+			rand_element(&a[2*j]);
+			rand_element(&b[2*j]);
+		}
+		start_timer();
+		mult_bitsliced64(a, b, c);
+		times_bitsliced[i] = stop_timer();
+		
+		start_timer();
+		for(int j = 0; j < 64; j++) {
+			mult_polynomial_lrcomb_window8(&a[2*j], &b[2*j], prod);
+			reduction_generic(prod);
+		}
+		times_window8[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times_bitsliced;
+	result.method_name = "mult_bitsliced64";
+	print_batch_stats(result, 64);
+	
+	result.times = times_window8;
+	result.method_name = "mult_polynomial_lrcomb_window8 + reduction_generic";
+	print_batch_stats(result, 64);
+}
+
+/* Inner product of 64 terms, one reduction vs one reduction per term */
+void benchmark_inner_product() {
+	int num_tests = global_num_tests / 10;
+	uint64_t times_lazy[num_tests];
+	uint64_t times_eager[num_tests];
+	
+	uint64_t a[128];
+	uint64_t b[128];
+	uint64_t c[2];
+	uint64_t prod[4];
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < 64; j++) {
+			rand_element(&a[2*j]);
+			rand_element(&b[2*j]);
+		}
+		start_timer();
+		inner_product(a, b, 64, c);
+		times_lazy[i] = stop_timer();
+		
+		start_timer();
+		c[0] = c[1] = 0;
+		for(int j = 0; j < 64; j++) {
+			mult_polynomial(&a[2*j], &b[2*j], prod);
+			reduction_generic(prod);
+			add(prod, c, c);
+		}
+		times_eager[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times_lazy;
+	result.method_name = "inner_product";
+	print_batch_stats(result, 64);
+	
+	result.times = times_eager;
+	result.method_name = "mult_polynomial + reduction_generic per term";
+	print_batch_stats(result, 64);
+}
+
+void benchmark_field_ctx_op(field_t * ctx, int op, int batch_size, char * method_name) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * a = malloc(FIELD_MAX_WORDS*batch_size*sizeof(uint64_t));
+	uint64_t * b = malloc(FIELD_MAX_WORDS*batch_size*sizeof(uint64_t));
+	uint64_t * c = malloc(FIELD_MAX_WORDS*batch_size*sizeof(uint64_t));
+	int len = ctx->len;
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < batch_size; j++) {
+			field_ctx_rand_element(ctx, &a[len*j]);
+			field_ctx_rand_element(ctx, &b[len*j]);
+			a[len*j] |= 1; // Nonzero for the inversion
+		}
+		start_timer();
+		for(int j = 0; j < batch_size; j++) {
+			if(op == 0) {
+				field_ctx_mult(ctx, &a[len*j], &b[len*j], &c[len*j]);
+			} else if(op == 1) {
+				field_ctx_square(ctx, &a[len*j], &c[len*j]);
+			} else {
+				field_ctx_inv(ctx, &a[len*j], &c[len*j]);
+			}
+		}
+		times[i] = stop_timer();
+	}
+	free(a);
+	free(b);
+	free(c);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_batch_stats(result, batch_size);
+}
+
+/* Every predefined field, and field_mul for comparison with the context of GF(2^127) */
+void benchmark_field_ctx() {
+	int ms[6] = {127, 163, 233, 283, 409, 571};
+	char * op_names[3] = {"field_ctx_mult", "field_ctx_square", "field_ctx_inv"};
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(ms[k]);
+		for(int op = 0; op < 3; op++) {
+			char method_name[64];
+			sprintf(method_name, "%s m = %d", op_names[op], ms[k]);
+			benchmark_field_ctx_op(ctx, op, op == 2 ? global_batch_size / 16 : global_batch_size, method_name);
+		}
+	}
+	benchmark_mult_batch_kernel(mult_batch_generic, "field_mul (mult_batch_generic)");
+}
+
+void benchmark_field_ctx_reduce(field_t * ctx, char * method_name) {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * p = malloc(2*FIELD_MAX_WORDS*global_batch_size*sizeof(uint64_t));
+	int len = ctx->len;
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < global_batch_size; j++) {
+			uint64_t a[FIELD_MAX_WORDS];
+			uint64_t b[FIELD_MAX_WORDS];
+			field_ctx_rand_element(ctx, a);
+			field_ctx_rand_element(ctx, b);
+			memset(&p[2*len*j], 0, 2*len*sizeof(uint64_t));
+			mult_polynomial(a, b, &p[2*len*j]);
+		}
+		start_timer();
+		for(int j = 0; j < global_batch_size; j++) {
+			field_ctx_reduce(ctx, &p[2*len*j]);
+		}
+		times[i] = stop_timer();
+	}
+	free(p);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_batch_stats(result, global_batch_size);
+}
+
+/* Barrett on a dense modulus and on the trinomial, next to the word-level reductions */
+void benchmark_field_barrett() {
+	uint64_t dense_f127[3] = {0x2bcd474348edfdbf, 0xe06eb671008c5d11, 0};
+	int terms[2] = {63, 0};
+	field_t dense;
+	field_t barrett;
+	field_t sparse;
+	field_init_barrett(&dense, 127, dense_f127);
+	field_init(&barrett, 127, terms, 2);
+	field_set_reduction(&barrett, FIELD_REDUCTION_BARRETT);
+	field_init(&sparse, 127, terms, 2);
+	field_set_reduction(&sparse, FIELD_REDUCTION_SPARSE);
+	
+	benchmark_field_ctx_reduce(&dense, "Barrett reduction, dense f of degree 127");
+	benchmark_field_ctx_reduce(&barrett, "Barrett reduction, z^127 + z^63 + 1");
+	benchmark_field_ctx_reduce(&sparse, "sparse reduction, z^127 + z^63 + 1");
+	benchmark_field_ctx_reduce(field_get(127), "reduction_trinomial");
+	benchmark_field_ctx_op(&dense, 0, global_batch_size, "field_ctx_mult dense f of degree 127");
+}
+
 void benchmark_square_polynomial() {
 	uint64_t times[global_num_tests];
 	
@@ -188,26 +942,36 @@ void benchmark_square_polynomial() {
 	print_stats(result);
 }
 
+/* Both reductions on the same products */
 void benchmark_reduction_generic() {
-	uint64_t times[global_num_tests];
+	uint64_t times_generic[global_num_tests];
+	uint64_t times_trinomial[global_num_tests];
 	
 	uint64_t a[4];
 	uint64_t b[4];
-	uint64_t ab[4];
+	uint64_t ab0[4];
+	uint64_t ab1[4];
 	for(int i = 0; i < global_num_tests; i++) {
 		rand_element(a);
 		rand_element(b);
-		mult_polynomial_lrcomb_window8(a, b, ab);
+		mult_polynomial_lrcomb_window8(a, b, ab0);
+		memcpy(ab1, ab0, sizeof(ab0));
 		start_timer();
-		reduction_generic(ab);
-		times[i] = stop_timer();
+		reduction_generic(ab0);
+		times_generic[i] = stop_timer();
+		start_timer();
+		reduction_trinomial(ab1);
+		times_trinomial[i] = stop_timer();
 	}
 	
 	benchmark_t result;
 	result.num_tests = global_num_tests;
-	result.times = times;
+	result.times = times_generic;
 	result.method_name = "reduction_generic";
 	print_stats(result);
+	result.times = times_trinomial;
+	result.method_name = "reduction_trinomial";
+	print_stats(result);
 }
 
 void benchmark_extended_euclid() {
@@ -270,15 +1034,337 @@ void benchmark_inv_binary() {
 	print_stats(result);
 }
 
+void benchmark_inv_itoh_tsujii_kernel(void (*inv)(uint64_t *, uint64_t *), char * method_name) {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t inva[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		inv(a, inva);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = method_name;
+	print_stats(result);
+}
+
+/* The constant-time chain next to the one with table multi-squarings */
+void benchmark_inv_itoh_tsujii() {
+	benchmark_inv_itoh_tsujii_kernel(inv_itoh_tsujii, "inv_itoh_tsujii");
+	benchmark_inv_itoh_tsujii_kernel(inv_itoh_tsujii_table, "inv_itoh_tsujii_table");
+}
+
+void benchmark_inv_safegcd() {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t inva[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		inv_safegcd(a, inva);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "inv_safegcd";
+	print_stats(result);
+}
+
+void benchmark_inv_almost_inverse() {
+	uint64_t times[global_num_tests];
+	
+	uint64_t a[2];
+	uint64_t inva[2];
+	for(int i = 0; i < global_num_tests; i++) {
+		rand_element(a);
+		start_timer();
+		inv_almost_inverse(a, inva);
+		times[i] = stop_timer();
+	}
+	
+	benchmark_t result;
+	result.num_tests = global_num_tests;
+	result.times = times;
+	result.method_name = "inv_almost_inverse";
+	print_stats(result);
+}
+
+/* Median ns of one inversion over the same inputs for every method */
+double inversion_median_ns(void (*inv)(uint64_t *, uint64_t *), uint64_t * inputs, int num_tests) {
+	uint64_t times[num_tests];
+	uint64_t inva[2];
+	for(int i = 0; i < num_tests; i++) {
+		start_timer();
+		inv(&inputs[2*i], inva);
+		times[i] = stop_timer();
+	}
+	qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+	return (double) times[num_tests / 2];
+}
+
+/* The three inversion families side by side: Euclid, binary and exponentiation */
+void benchmark_inversion_families() {
+	uint64_t inputs[2*global_num_tests];
+	for(int i = 0; i < global_num_tests; i++) {
+		do {
+			rand_element(&inputs[2*i]);
+		} while(inputs[2*i] == 0 && inputs[2*i + 1] == 0);
+	}
+	printf("Benchmark of the inversion families, median ns:\n");
+	printf("  euclid     inv_euclid          %8.0f\n", inversion_median_ns(inv_euclid, inputs, global_num_tests));
+	printf("  euclid     inv_safegcd         %8.0f\n", inversion_median_ns(inv_safegcd, inputs, global_num_tests));
+	printf("  binary     inv_binary          %8.0f\n", inversion_median_ns(inv_binary, inputs, global_num_tests));
+	printf("  binary     inv_almost_inverse  %8.0f\n", inversion_median_ns(inv_almost_inverse, inputs, global_num_tests));
+	printf("  exponent   inv_itoh_tsujii     %8.0f\n", inversion_median_ns(inv_itoh_tsujii, inputs, global_num_tests));
+	printf("  exponent   inv_itoh_tsujii_table %6.0f\n\n", inversion_median_ns(inv_itoh_tsujii_table, inputs, global_num_tests));
+}
+
+/* Median ns of b/a, with div if inv is NULL, else inv followed by field_mul */
+double division_median_ns(void (*div)(uint64_t *, uint64_t *, uint64_t *), void (*inv)(uint64_t *, uint64_t *),
+	uint64_t * inputs, int num_tests) {
+	uint64_t times[num_tests];
+	uint64_t c[2];
+	uint64_t inva[2];
+	for(int i = 0; i < num_tests; i++) {
+		uint64_t * a = &inputs[4*i];
+		uint64_t * b = &inputs[4*i + 2];
+		start_timer();
+		if(inv == NULL) {
+			div(b, a, c);
+		} else {
+			inv(a, inva);
+			field_mul(b, inva, c);
+		}
+		times[i] = stop_timer();
+	}
+	qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+	return (double) times[num_tests / 2];
+}
+
+/* field_div against inversion followed by a multiplication */
+void benchmark_field_div() {
+	uint64_t inputs[4*global_num_tests];
+	for(int i = 0; i < global_num_tests; i++) {
+		do {
+			rand_element(&inputs[4*i]);
+		} while(inputs[4*i] == 0 && inputs[4*i + 1] == 0);
+		rand_element(&inputs[4*i + 2]);
+	}
+	int n = global_num_tests;
+	printf("Benchmark of field_div, median ns of b/a:\n");
+	printf("  field_div                     %8.0f\n", division_median_ns(field_div, NULL, inputs, n));
+	printf("  field_div_almost_inverse      %8.0f\n", division_median_ns(field_div_almost_inverse, NULL, inputs, n));
+	printf("  inv_euclid + field_mul        %8.0f\n", division_median_ns(NULL, inv_euclid, inputs, n));
+	printf("  inv_binary + field_mul        %8.0f\n", division_median_ns(NULL, inv_binary, inputs, n));
+	printf("  inv_almost_inverse + field_mul %7.0f\n", division_median_ns(NULL, inv_almost_inverse, inputs, n));
+	printf("  inv_itoh_tsujii + field_mul   %8.0f\n\n", division_median_ns(NULL, inv_itoh_tsujii, inputs, n));
+}
+
+/* Median ns per element over a few runs of n elements, a NULL out inverts in place */
+double batch_invert_median_ns(uint64_t * a, uint64_t * out, uint64_t n, int num_tests) {
+	uint64_t times[num_tests];
+	for(int i = 0; i < num_tests; i++) {
+		for(uint64_t j = 0; j < n; j++) {
+			rand_element(&a[2*j]);
+		}
+		start_timer();
+		if(out == NULL) {
+			batch_invert_in_place(a, n);
+		} else {
+			batch_invert(a, out, n);
+		}
+		times[i] = stop_timer();
+	}
+	qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+	return (double) times[num_tests / 2] / n;
+}
+
+/*
+* Per element cost of batch_invert and batch_invert_in_place for n = 1 ... 1e6,
+* against inv_euclid per element, measured on up to 1000 elements.
+*/
+void benchmark_batch_invert() {
+	uint64_t max_n = 1000000;
+	uint64_t * a = malloc(2*max_n*sizeof(uint64_t));
+	uint64_t * out = malloc(2*max_n*sizeof(uint64_t));
+	printf("Benchmark of batch_invert, median ns per element:\n");
+	printf("      n  batch_invert  in_place  inv_euclid\n");
+	for(uint64_t n = 1; n <= max_n; n *= 10) {
+		int num_tests = n >= 100000 ? 3 : 11;
+		double batch = batch_invert_median_ns(a, out, n, num_tests);
+		double in_place = batch_invert_median_ns(a, NULL, n, num_tests);
+		
+		uint64_t euclid_n = n < 1000 ? n : 1000;
+		uint64_t times[num_tests];
+		for(int i = 0; i < num_tests; i++) {
+			for(uint64_t j = 0; j < euclid_n; j++) {
+				rand_element(&a[2*j]);
+			}
+			start_timer();
+			for(uint64_t j = 0; j < euclid_n; j++) {
+				inv_euclid(&a[2*j], &out[2*j]);
+			}
+			times[i] = stop_timer();
+		}
+		qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+		double euclid = (double) times[num_tests / 2] / euclid_n;
+		printf("%7" PRIu64 " %13.2f %9.2f %11.2f\n", n, batch, in_place, euclid);
+	}
+	printf("\n");
+	free(a);
+	free(out);
+}
+
+/* Median ns per element of an inv_array kernel over a few runs of n elements */
+double inv_array_median_ns(void (*kernel)(uint64_t *, uint64_t *, uint64_t), uint64_t * a, uint64_t * out, uint64_t n, int num_tests) {
+	uint64_t times[num_tests];
+	for(int i = 0; i < num_tests; i++) {
+		for(uint64_t j = 0; j < n; j++) {
+			rand_element(&a[2*j]);
+		}
+		start_timer();
+		kernel(a, out, n);
+		times[i] = stop_timer();
+	}
+	qsort(times, num_tests, sizeof(uint64_t), compare_uint64_t);
+	return (double) times[num_tests / 2] / n;
+}
+
+/*
+* Per element cost of inv_array, its kernels and batch_invert for small n,
+* a kernel the CPU does not support shows as nan.
+*/
+void benchmark_inv_array() {
+	uint64_t max_n = 1024;
+	uint64_t a[2*max_n];
+	uint64_t out[2*max_n];
+	printf("Benchmark of inv_array, median ns per element:\n");
+	printf("      n  inv_array   vpclmul  vpclmul_avx2   generic  batch_invert\n");
+	for(uint64_t n = 1; n <= max_n; n *= 4) {
+		/* Small n needs more runs for a stable median */
+		int num_tests = n < 64 ? 1001 : 101;
+		double dispatched = inv_array_median_ns(inv_array, a, out, n, num_tests);
+		double vpclmul = NAN;
+		if(cpu_supports_vpclmul()) {
+			vpclmul = inv_array_median_ns(inv_array_vpclmul, a, out, n, num_tests);
+		}
+		double vpclmul_avx2 = NAN;
+		if(cpu_supports_vpclmul_avx2()) {
+			vpclmul_avx2 = inv_array_median_ns(inv_array_vpclmul_avx2, a, out, n, num_tests);
+		}
+		double generic = inv_array_median_ns(inv_array_generic, a, out, n, num_tests);
+		double batch = batch_invert_median_ns(a, out, n, num_tests);
+		printf("%7" PRIu64 " %10.2f %9.2f %13.2f %9.2f %13.2f\n", n, dispatched, vpclmul, vpclmul_avx2,
+			generic, batch);
+	}
+	printf("\n");
+}
+
+/* Traces of a batch, summed so that the loop is not optimized away */
+void benchmark_field_trace() {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * a = malloc(2*global_batch_size*sizeof(uint64_t));
+	uint64_t sum = 0;
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < global_batch_size; j++) {
+			rand_element(&a[2*j]);
+		}
+		start_timer();
+		for(int j = 0; j < global_batch_size; j++) {
+			sum += field_trace(&a[2*j]);
+		}
+		times[i] = stop_timer();
+	}
+	free(a);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = "field_trace";
+	print_batch_stats(result, global_batch_size);
+	printf("Ones among the traces: %" PRIu64 "\n\n", sum);
+}
+
+void benchmark_field_halftrace() {
+	benchmark_field_sqrt_kernel(field_halftrace, "field_halftrace");
+	benchmark_field_sqrt_kernel(field_halftrace_iterated, "field_halftrace_iterated");
+}
+
+void benchmark_field_solve_quadratic_batch() {
+	int num_tests = global_num_tests / 10;
+	uint64_t times[num_tests];
+	
+	uint64_t * c = malloc(2*global_batch_size*sizeof(uint64_t));
+	uint64_t * x = malloc(2*global_batch_size*sizeof(uint64_t));
+	bool * solvable = malloc(global_batch_size*sizeof(bool));
+	for(int i = 0; i < num_tests; i++) {
+		for(int j = 0; j < global_batch_size; j++) {
+			rand_element(&c[2*j]);
+		}
+		start_timer();
+		field_solve_quadratic_batch(c, x, solvable, global_batch_size);
+		times[i] = stop_timer();
+	}
+	free(c);
+	free(x);
+	free(solvable);
+	
+	benchmark_t result;
+	result.num_tests = num_tests;
+	result.times = times;
+	result.method_name = "field_solve_quadratic_batch";
+	print_batch_stats(result, global_batch_size);
+}
+
 void benchmark_all() {
-	benchmark_add();
-	benchmark_mult_shiftadd();
-	benchmark_mult_polynomial_rlcomb();
-	benchmark_mult_polynomial_lrcomb();
-	benchmark_mult_polynomial_lrcomb_window8();
-	benchmark_square_polynomial();
-	benchmark_reduction_generic();
-	benchmark_extended_euclid();
-	benchmark_inv_euclid();
-	benchmark_inv_binary();
+	RUN_BENCHMARK(benchmark_add);
+	RUN_BENCHMARK(benchmark_mult_shiftadd);
+	RUN_BENCHMARK(benchmark_mult_polynomial_rlcomb);
+	RUN_BENCHMARK(benchmark_mult_polynomial_lrcomb);
+	RUN_BENCHMARK(benchmark_mult_polynomial_lrcomb_window8);
+	RUN_BENCHMARK(benchmark_mult_polynomial_lrcomb_window_sweep);
+	RUN_BENCHMARK(benchmark_prepare_multiplicand);
+	RUN_BENCHMARK(benchmark_mult_polynomial_prepared);
+	RUN_BENCHMARK(benchmark_mult_karatsuba);
+	RUN_BENCHMARK(benchmark_mult_polynomial_holes);
+	RUN_BENCHMARK(benchmark_mult_polynomial_clmul);
+	RUN_BENCHMARK(benchmark_mult_polynomial);
+	RUN_BENCHMARK(benchmark_field_mul);
+	RUN_BENCHMARK(benchmark_mult_sparse);
+	RUN_BENCHMARK(benchmark_mult_monomial);
+	RUN_BENCHMARK(benchmark_mult_batch);
+	RUN_BENCHMARK(benchmark_mult_bitsliced64);
+	RUN_BENCHMARK(benchmark_inner_product);
+	RUN_BENCHMARK(benchmark_field_ctx);
+	RUN_BENCHMARK(benchmark_field_barrett);
+	RUN_BENCHMARK(benchmark_square_polynomial);
+	RUN_BENCHMARK(benchmark_field_square);
+	RUN_BENCHMARK(benchmark_field_square_array);
+	RUN_BENCHMARK(benchmark_field_multisquare);
+	RUN_BENCHMARK(benchmark_field_sqrt);
+	RUN_BENCHMARK(benchmark_field_lazy);
+	RUN_BENCHMARK(benchmark_reduction_generic);
+	RUN_BENCHMARK(benchmark_extended_euclid);
+	RUN_BENCHMARK(benchmark_inv_euclid);
+	RUN_BENCHMARK(benchmark_inv_binary);
+	RUN_BENCHMARK(benchmark_inv_almost_inverse);
+	RUN_BENCHMARK(benchmark_inv_itoh_tsujii);
+	RUN_BENCHMARK(benchmark_inv_safegcd);
+	RUN_BENCHMARK(benchmark_inversion_families);
+	RUN_BENCHMARK(benchmark_field_div);
+	RUN_BENCHMARK(benchmark_batch_invert);
+	RUN_BENCHMARK(benchmark_inv_array);
+	RUN_BENCHMARK(benchmark_field_trace);
+	RUN_BENCHMARK(benchmark_field_halftrace);
+	RUN_BENCHMARK(benchmark_field_solve_quadratic_batch);
 }
@@ -1,5 +1,6 @@
 #include <binaryfield.h>
 #include <time.h>
+#include <math.h>
 
 void start_timer();
 
@@ -15,8 +16,48 @@ void benchmark_mult_polynomial_lrcomb();
 
 void benchmark_mult_polynomial_lrcomb_window8();
 
+void benchmark_mult_polynomial_lrcomb_window_sweep();
+
+void benchmark_prepare_multiplicand();
+
+void benchmark_mult_polynomial_prepared();
+
+void benchmark_mult_karatsuba();
+
+void benchmark_mult_polynomial_holes();
+
+void benchmark_mult_polynomial_clmul();
+
+void benchmark_mult_polynomial();
+
+void benchmark_field_mul();
+
+void benchmark_mult_sparse();
+
+void benchmark_mult_monomial();
+
+void benchmark_mult_batch();
+
+void benchmark_mult_bitsliced64();
+
+void benchmark_inner_product();
+
+void benchmark_field_ctx();
+
+void benchmark_field_barrett();
+
 void benchmark_square_polynomial();
 
+void benchmark_field_square();
+
+void benchmark_field_square_array();
+
+void benchmark_field_multisquare();
+
+void benchmark_field_sqrt();
+
+void benchmark_field_lazy();
+
 void benchmark_reduction_generic();
 
 void benchmark_extended_euclid();
@@ -25,4 +66,24 @@ void benchmark_inv_euclid();
 
 void benchmark_inv_binary();
 
+void benchmark_inv_almost_inverse();
+
+void benchmark_inv_itoh_tsujii();
+
+void benchmark_inv_safegcd();
+
+void benchmark_inversion_families();
+
+void benchmark_field_div();
+
+void benchmark_batch_invert();
+
+void benchmark_inv_array();
+
+void benchmark_field_trace();
+
+void benchmark_field_halftrace();
+
+void benchmark_field_solve_quadratic_batch();
+
 void benchmark_all();
\ No newline at end of file
@@ -498,6 +498,83 @@ void reduction_generic_correctness_tests() {
 	eval_test(reduction_generic_not_reducing_when_less_than_f());
 }
 
+/* ======================== reduction_trinomial ============================== */
+
+result_t reduction_trinomial_case_large_degree() {
+	//Arrange
+	uint64_t a[4];
+	uint64_t indicesa[3] = {0, 198, 252};
+	index_to_polynomial(indicesa, 3, a, 4);
+	uint64_t expected[2];
+	uint64_t indicese[7] = {0, 7, 61, 70, 71, 124, 125};
+	index_to_polynomial(indicese, 7, expected, 2);
+	
+	//Act
+	reduction_trinomial(a);
+	
+	//Assert
+	bool correct = equal_polynomials(a, expected, 2) && a[2] == 0 && a[3] == 0;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "reduction_trinomial_case_large_degree FAILED";
+	return result;
+}
+
+result_t reduction_trinomial_crossreference_reduction_generic() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		rand_element(a);
+		rand_element(b);
+		mult_polynomial(a, b, ab0);
+		memcpy(ab1, ab0, sizeof(ab0));
+		
+		//Act
+		reduction_trinomial(ab0);
+		reduction_generic(ab1);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab1, 4);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "reduction_trinomial_crossreference_reduction_generic FAILED";
+	return result;
+}
+
+result_t reduction_trinomial_bit_127() {
+	//Arrange
+	uint64_t a[4] = {0, 0x8000000000000000, 0, 0}; // z^127
+	uint64_t expected[2] = {0x8000000000000001, 0}; // z^63 + 1
+	
+	//Act
+	reduction_trinomial(a);
+	
+	//Assert
+	bool correct = equal_polynomials(a, expected, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "reduction_trinomial_bit_127 FAILED";
+	return result;
+}
+
+void reduction_trinomial_correctness_tests() {
+	eval_test(reduction_trinomial_case_large_degree());
+	eval_test(reduction_trinomial_crossreference_reduction_generic());
+	eval_test(reduction_trinomial_bit_127());
+}
+
 /* ======================= square_polynomial ======================== */
 
 result_t square_polynomial_case() {
@@ -1113,6 +1190,95 @@ void mult_polynomial_lrcomb_correctness_tests() {
 	eval_test(mult_polynomial_lrcomb_nonzero_with_zero_is_zero());
 }
 
+/* ======================= mult_polynomial_lrcomb_window =============== */
+
+int lrcomb_widths[6] = {2, 3, 4, 5, 6, 8};
+
+void (*lrcomb_specialized[6])(uint64_t *, uint64_t *, uint64_t *) = {
+	mult_polynomial_lrcomb_w2, mult_polynomial_lrcomb_w3, mult_polynomial_lrcomb_w4,
+	mult_polynomial_lrcomb_w5, mult_polynomial_lrcomb_w6, mult_polynomial_lrcomb_w8
+};
+
+result_t mult_polynomial_lrcomb_w_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[4] = {0, 13, 20, 126};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {1, 20, 40, 50};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_ab[4];
+	uint64_t indicesab[14] = {1, 14, 20, 21, 33, 50, 53, 60, 63, 70, 127, 146, 166, 176};
+	index_to_polynomial(indicesab, 14, expected_ab, 4);
+	uint64_t ab[4];
+	bool correct = 1;
+	
+	//Act & Assert
+	for(int i = 0; i < 6; i++) {
+		lrcomb_specialized[i](a, b, ab);
+		correct = correct && equal_polynomials(ab, expected_ab, 4);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_lrcomb_w_case FAILED";
+	return result;
+}
+
+result_t mult_polynomial_lrcomb_w_crossreference_karatsuba() {
+	//Arrange
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t b[2] = {0x9E3779B97F4A7C15, 0x7F4A7C159E3779B9};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	bool correct = 1;
+	
+	//Act & Assert
+	mult_karatsuba(a, b, ab1);
+	for(int i = 0; i < 6; i++) {
+		lrcomb_specialized[i](a, b, ab0);
+		correct = correct && equal_polynomials(ab0, ab1, 4);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_lrcomb_w_crossreference_karatsuba FAILED";
+	return result;
+}
+
+result_t mult_polynomial_lrcomb_window_runtime_widths() {
+	//Arrange
+	uint64_t a[2] = {6234567985233, 18638245347};
+	uint64_t b[2] = {9087872, 2305473123560};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	bool correct = 1;
+	
+	//Act & Assert
+	mult_polynomial_rlcomb(a, b, ab1);
+	for(int w = 1; w <= 8; w++) {
+		mult_polynomial_lrcomb_window(a, b, ab0, w);
+		correct = correct && equal_polynomials(ab0, ab1, 4);
+	}
+	/* Widths above 8 are rejected and computed with w = 8 */
+	mult_polynomial_lrcomb_window(a, b, ab0, 16);
+	correct = correct && equal_polynomials(ab0, ab1, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_lrcomb_window_runtime_widths FAILED";
+	return result;
+}
+
+void mult_polynomial_lrcomb_window_correctness_tests() {
+	eval_test(mult_polynomial_lrcomb_w_case());
+	eval_test(mult_polynomial_lrcomb_w_crossreference_karatsuba());
+	eval_test(mult_polynomial_lrcomb_window_runtime_widths());
+}
+
 /* ======================= mult_polynomial_lrcomb_window8 =============== */
 
 
@@ -1400,249 +1566,2720 @@ void mult_polynomial_lrcomb_window8_correctness_tests() {
 	eval_test(mult_polynomial_lrcomb_window8_nonzero_with_zero_is_zero());
 }
 
-/* =======================extended_euclid ============================== */
+/* ======================= accumulator =============== */
 
-result_t extended_euclid_coprime_case() {
+result_t inner_product_crossreference_shiftadd() {
 	//Arrange
-	uint64_t a[2];
-	uint64_t indicesa[3] = {0, 3, 40};
-	index_to_polynomial(indicesa, 3, a, 2);
-	uint64_t b[2];
-	uint64_t indicesb[2] = {2, 83};
-	index_to_polynomial(indicesb, 2, b, 2);
-	uint64_t expected_gcd[2] = {1, 0};
-	uint64_t expected_g[2];
-	uint64_t indicesg[43] = {0, 2, 3, 5, 6, 7, 9, 12, 14, 15, 19, 20, 22, 23, 24, 25, 27, 28, 30, 32, 33, 35, 36, 39, 41, 43, 44, 45, 48, 49, 51, 55, 58, 59, 60, 61, 65, 67, 72, 73, 79, 81, 82};
-	index_to_polynomial(indicesg, 46, expected_g, 2);
-	uint64_t expected_h[2];
-	uint64_t indicesh[16] = {0, 5, 6, 8, 12, 15, 16, 17, 18, 22, 24, 29, 30, 36, 38, 39};
-	index_to_polynomial(indicesh, 17, expected_h, 2);
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t n = 20;
+	uint64_t a[40];
+	uint64_t b[40];
+	uint64_t expected[2] = {0, 0};
+	uint64_t prod[2];
+	uint64_t actual[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+		rand_element(&b[2*i]);
+		mult_shiftadd(&a[2*i], &b[2*i], prod);
+		add(prod, expected, expected);
+	}
 	
 	//Act
-	extended_euclid(a, b, gcd, g, h);
+	inner_product(a, b, n, actual);
 	
 	//Assert
-	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
-	bool correct_g = equal_polynomials(g, expected_g, 2);
-	bool correct_h = equal_polynomials(h, expected_h, 2);
+	bool correct = equal_polynomials(expected, actual, 2);
 	
 	//Return
 	result_t result;
-	result.success = correct_gcd && correct_g && correct_h;
-	result.fail_msg = "extended_euclid_coprime_case FAILED";
+	result.success = correct;
+	result.fail_msg = "inner_product_crossreference_shiftadd FAILED";
 	return result;
 }
 
-result_t extended_euclid_common_factor_case() {
+result_t inner_product_empty_is_zero() {
 	//Arrange
-	uint64_t a[2];
-	uint64_t indicesa[4] = {1, 2, 4, 5};
-	index_to_polynomial(indicesa, 4, a, 2);
-	uint64_t b[2];
-	uint64_t indicesb[4] = {3, 4, 5, 6};
-	index_to_polynomial(indicesb, 4, b, 2);
-	uint64_t expected_gcd[2];
-	uint64_t indicesgcd[2] = {1, 3};
-	index_to_polynomial(indicesgcd, 2, expected_gcd, 2);
-	uint64_t expected_g[2];
-	uint64_t indicesg[3] = {0, 1, 2};
-	index_to_polynomial(indicesg, 3, expected_g, 2);
-	uint64_t expected_h[2];
-	uint64_t indicesh[2] = {0, 1};
-	index_to_polynomial(indicesh, 2, expected_h, 2);
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t a[2] = {5, 7};
+	uint64_t zero[2] = {0, 0};
+	uint64_t actual[2] = {1, 1};
 	
 	//Act
-	extended_euclid(a, b, gcd, g, h);
+	inner_product(a, a, 0, actual);
 	
 	//Assert
-	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
-	bool correct_g = equal_polynomials(g, expected_g, 2);
-	bool correct_h = equal_polynomials(h, expected_h, 2);
+	bool correct = equal_polynomials(zero, actual, 2);
 	
 	//Return
 	result_t result;
-	result.success = correct_gcd && correct_g && correct_h;
-	result.fail_msg = "extended_euclid_common_factor_case FAILED";
+	result.success = correct;
+	result.fail_msg = "inner_product_empty_is_zero FAILED";
 	return result;
 }
 
-result_t extended_euclid_cross_reference_g_and_h() {
+result_t accumulator_finalize_keeps_accumulating() {
 	//Arrange
-	uint64_t a[2] = {528723069, 9831505791};
-	uint64_t b[2] = {120687981035, 8412205886};
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
-	uint64_t ag[2];
-	uint64_t bh[2];
-	uint64_t sum[2];
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t b[2] = {4682043888526, 7512369852};
+	uint64_t c[2] = {259398971125881, 98752520481};
+	uint64_t ab[2];
+	uint64_t ac[2];
+	uint64_t expected[2];
+	uint64_t partial[2];
+	uint64_t actual[2];
+	accumulator_t acc;
 	
 	//Act
-	extended_euclid(a, b, gcd, g, h);
-	mult_shiftadd(a, g, ag);
-	mult_shiftadd(b, h, bh);
-	add(ag, bh, sum);
+	accumulator_init(&acc);
+	accumulator_mult_add(&acc, a, b);
+	accumulator_finalize(&acc, partial);
+	accumulator_mult_add(&acc, a, c);
+	accumulator_finalize(&acc, actual);
 	
 	//Assert
-	bool correct = equal_polynomials(sum, gcd, 2);
+	mult_shiftadd(a, b, ab);
+	mult_shiftadd(a, c, ac);
+	add(ab, ac, expected);
+	bool correct = equal_polynomials(ab, partial, 2) && equal_polynomials(expected, actual, 2);
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "extended_euclid_cross_reference_g_and_h FAILED";
+	result.fail_msg = "accumulator_finalize_keeps_accumulating FAILED";
 	return result;
 }
 
-result_t extended_euclid_not_modifying_operands() {
+void accumulator_correctness_tests() {
+	eval_test(inner_product_crossreference_shiftadd());
+	eval_test(inner_product_empty_is_zero());
+	eval_test(accumulator_finalize_keeps_accumulating());
+}
+
+/* ======================= mult_bitsliced64 =============== */
+
+result_t mult_bitsliced64_crossreference_shiftadd() {
 	//Arrange
-	uint64_t a0[2] = {252242103978283, 7892013649722};
-	uint64_t a1[2] = {252242103978283, 7892013649722};
-	uint64_t b0[2] = {710369852471, 3028945612774};
-	uint64_t b1[2] = {710369852471, 3028945612774};
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t a[128];
+	uint64_t b[128];
+	uint64_t ab0[128];
+	uint64_t ab1[2];
+	for(int i = 0; i < 64; i++) {
+		rand_element(&a[2*i]);
+		rand_element(&b[2*i]);
+	}
 	
 	//Act
-	extended_euclid(a1, b1, gcd, g, h);
+	mult_bitsliced64(a, b, ab0);
 	
 	//Assert
-	bool samea = equal_polynomials(a0, a1, 2);
-	bool sameb = equal_polynomials(b0, b1, 2);
+	bool correct = 1;
+	for(int i = 0; i < 64; i++) {
+		mult_shiftadd(&a[2*i], &b[2*i], ab1);
+		correct = correct && equal_polynomials(&ab0[2*i], ab1, 2);
+	}
 	
 	//Return
 	result_t result;
-	result.success = samea && sameb;
-	result.fail_msg = "extended_euclid_not_modifying_operands FAILED";
+	result.success = correct;
+	result.fail_msg = "mult_bitsliced64_crossreference_shiftadd FAILED";
 	return result;
 }
 
-result_t extended_euclid_one_with_nonzero_has_gcd_one() {
+result_t mult_bitsliced64_with_one_is_same() {
 	//Arrange
-	uint64_t one[2] = {1, 0};
-	uint64_t b[2] = {7645869580749671, 758135679};
-	uint64_t expected_gcd[2] = {1, 0};
-	uint64_t expected_g[2] = {1, 0};
-	uint64_t expected_h[2] = {0, 0};
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t a[128];
+	uint64_t one[128];
+	uint64_t prod[128];
+	for(int i = 0; i < 64; i++) {
+		rand_element(&a[2*i]);
+		one[2*i] = 1;
+		one[2*i + 1] = 0;
+	}
 	
 	//Act
-	extended_euclid(one, b, gcd, g, h);
+	mult_bitsliced64(a, one, prod);
 	
 	//Assert
-	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
-	bool correct_g = equal_polynomials(g, expected_g, 2);
-	bool correct_h = equal_polynomials(h, expected_h, 2);
+	bool correct = equal_polynomials(a, prod, 128);
 	
 	//Return
 	result_t result;
-	result.success = correct_gcd && correct_g && correct_h;
-	result.fail_msg = "extended_euclid_one_with_nonzero_has_gcd_one FAILED";
+	result.success = correct;
+	result.fail_msg = "mult_bitsliced64_with_one_is_same FAILED";
 	return result;
 }
 
-void extended_euclid_correctness_tests() {
-	eval_test(extended_euclid_coprime_case());
-	eval_test(extended_euclid_common_factor_case());
-	eval_test(extended_euclid_cross_reference_g_and_h());
-	eval_test(extended_euclid_not_modifying_operands());
-	eval_test(extended_euclid_one_with_nonzero_has_gcd_one());
-}
-
-/* ================================ inv_euclid ================================ */
-
-result_t inv_euclid_case() {
+result_t mult_bitsliced64_max_degree_operands() {
 	//Arrange
-	uint64_t a[2];
-	uint64_t indicesa[3] = {126};
-	index_to_polynomial(indicesa, 3, a, 2);
-	uint64_t expected_inva[2];
-	uint64_t indicesinva[3] = {0, 1, 64};
-	index_to_polynomial(indicesinva, 3, expected_inva, 2);
-	uint64_t inva[2];
+	uint64_t a[128];
+	uint64_t b[128];
+	uint64_t ab0[128];
+	uint64_t ab1[2];
+	for(int i = 0; i < 64; i++) {
+		a[2*i] = 0xFFFFFFFFFFFFFFFF;
+		a[2*i + 1] = 0x7FFFFFFFFFFFFFFF;
+		rand_element(&b[2*i]);
+	}
 	
 	//Act
-	inv_euclid(a, inva);
+	mult_bitsliced64(a, b, ab0);
 	
 	//Assert
-	bool correct = equal_polynomials(inva, expected_inva, 2);
+	bool correct = 1;
+	for(int i = 0; i < 64; i++) {
+		mult_shiftadd(&a[2*i], &b[2*i], ab1);
+		correct = correct && equal_polynomials(&ab0[2*i], ab1, 2);
+	}
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_euclid_case FAILED";
+	result.fail_msg = "mult_bitsliced64_max_degree_operands FAILED";
 	return result;
 }
 
-result_t inv_euclid_not_modifying_operand() {
+void mult_bitsliced64_correctness_tests() {
+	eval_test(mult_bitsliced64_crossreference_shiftadd());
+	eval_test(mult_bitsliced64_with_one_is_same());
+	eval_test(mult_bitsliced64_max_degree_operands());
+}
+
+/* ======================= mult_karatsuba =============== */
+
+result_t mult_karatsuba_case() {
 	//Arrange
-	uint64_t a0[2] = {18820369423762, 77812309820}; 
-	uint64_t a1[2] = {18820369423762, 77812309820}; 
-	uint64_t inva[2];
+	uint64_t a[2];
+	uint64_t indicesa[4] = {0, 13, 20, 126};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {1, 20, 40, 50};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_ab[4];
+	uint64_t indicesab[14] = {1, 14, 20, 21, 33, 50, 53, 60, 63, 70, 127, 146, 166, 176};
+	index_to_polynomial(indicesab, 14, expected_ab, 4);
+	uint64_t ab[4];
 	
 	//Act
-	inv_euclid(a1, inva);
+	mult_karatsuba(a, b, ab);
 	
 	//Assert
-	bool correct = equal_polynomials(a0, a1, 2);
+	bool correct = equal_polynomials(ab, expected_ab, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_case FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_not_modifying_operands() {
+	//Arrange
+	uint64_t a0[2] = {12529730, 896271426};
+	uint64_t a1[2] = {12529730, 896271426};
+	uint64_t b0[2] = {93478201365, 87966666};
+	uint64_t b1[2] = {93478201365, 87966666};
+	uint64_t ab[4];
+	
+	//Act
+	mult_karatsuba(a1, b1, ab);
+	
+	//Assert
+	bool samea = equal_polynomials(a0, a1, 2);
+	bool sameb = equal_polynomials(b0, b1, 2);
+	
+	//Return
+	result_t result;
+	result.success = samea && sameb;
+	result.fail_msg = "mult_karatsuba_not_modifying_operands FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2] = {1935724302108, 485126568431};
+	uint64_t b[2] = {7234567891076432, 983221};
+	uint64_t ab0[4];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_karatsuba(a, b, ab0);
+	reduction_generic(ab0);
+	mult_shiftadd(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_crossreference_rlcomb() {
+	//Arrange
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t b[2] = {0xF0E1D2C3B4A59687, 0x7A5A5A5A5A5A5A5A};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	
+	//Act
+	mult_karatsuba(a, b, ab0);
+	mult_polynomial_rlcomb(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_crossreference_rlcomb FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_crossreference_square() {
+	//Arrange
+	uint64_t a[2] = {15996746004, 7855486213975};
+	uint64_t aprod[4];
+	uint64_t asquare[4];
+	
+	//Act
+	mult_karatsuba(a, a, aprod);
+	square_polynomial(a, asquare);
+	
+	//Assert
+	bool correct = equal_polynomials(aprod, asquare, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_crossreference_square FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_commutative() {
+	//Arrange
+	uint64_t a[2] = {67821035862049, 851586217803};
+	uint64_t b[2] = {8527932468052827, 784512058952025852};
+	uint64_t ab[4];
+	uint64_t ba[4];
+	
+	//Act
+	mult_karatsuba(a, b, ab);
+	mult_karatsuba(b, a, ba);
+	
+	//Assert
+	bool correct = equal_polynomials(ab, ba, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_commutative FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_nonzero_with_one_is_same() {
+	//Arrange
+	uint64_t a[4] = {331245254110210982, 127931, 0, 0};
+	uint64_t one[2] = {1, 0};
+	uint64_t prod[4];
+	
+	//Act
+	mult_karatsuba(a, one, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(a, prod, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_nonzero_with_one_is_same FAILED";
+	return result;
+}
+
+result_t mult_karatsuba_nonzero_with_zero_is_zero() {
+	//Arrange
+	uint64_t a[2] = {962478133025520, 1002369712026};
+	uint64_t zero[4] = {0, 0, 0, 0};
+	uint64_t prod[4];
+	
+	//Act
+	mult_karatsuba(a, zero, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(zero, prod, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_karatsuba_nonzero_with_zero_is_zero FAILED";
+	return result;
+}
+
+void mult_karatsuba_correctness_tests() {
+	eval_test(mult_karatsuba_case());
+	eval_test(mult_karatsuba_not_modifying_operands());
+	eval_test(mult_karatsuba_crossreference_shiftadd());
+	eval_test(mult_karatsuba_crossreference_rlcomb());
+	eval_test(mult_karatsuba_crossreference_square());
+	eval_test(mult_karatsuba_commutative());
+	eval_test(mult_karatsuba_nonzero_with_one_is_same());
+	eval_test(mult_karatsuba_nonzero_with_zero_is_zero());
+}
+
+/* ======================= mult_polynomial_prepared =============== */
+
+result_t mult_polynomial_prepared_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[4] = {0, 13, 20, 126};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {1, 20, 40, 50};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_ab[4];
+	uint64_t indicesab[14] = {1, 14, 20, 21, 33, 50, 53, 60, 63, 70, 127, 146, 166, 176};
+	index_to_polynomial(indicesab, 14, expected_ab, 4);
+	uint64_t ab4[4];
+	uint64_t ab8[4];
+	prepared_multiplicand_t prepared4;
+	prepared_multiplicand_t prepared8;
+	
+	//Act
+	prepare_multiplicand(b, 4, &prepared4);
+	prepare_multiplicand(b, 8, &prepared8);
+	mult_polynomial_prepared(a, &prepared4, ab4);
+	mult_polynomial_prepared(a, &prepared8, ab8);
+	
+	//Assert
+	bool correct = equal_polynomials(ab4, expected_ab, 4) && equal_polynomials(ab8, expected_ab, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_prepared_case FAILED";
+	return result;
+}
+
+result_t mult_polynomial_prepared_reused_crossreference_karatsuba() {
+	//Arrange
+	uint64_t b[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t a[2];
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	uint64_t ab2[4];
+	prepared_multiplicand_t prepared4;
+	prepared_multiplicand_t prepared8;
+	bool correct = 1;
+	
+	//Act
+	prepare_multiplicand(b, 4, &prepared4);
+	prepare_multiplicand(b, 8, &prepared8);
+	for(int i = 0; i < 8; i++) {
+		rand_element(a);
+		mult_polynomial_prepared(a, &prepared4, ab0);
+		mult_polynomial_prepared(a, &prepared8, ab1);
+		mult_karatsuba(a, b, ab2);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab2, 4) && equal_polynomials(ab1, ab2, 4);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_prepared_reused_crossreference_karatsuba FAILED";
+	return result;
+}
+
+result_t mult_polynomial_prepared_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2] = {259398971125881, 98752520481};
+	uint64_t b[2] = {973025584, 89930471};
+	uint64_t ab0[4];
+	uint64_t ab1[2];
+	prepared_multiplicand_t prepared;
+	
+	//Act
+	prepare_multiplicand(b, 8, &prepared);
+	mult_polynomial_prepared(a, &prepared, ab0);
+	reduction_generic(ab0);
+	mult_shiftadd(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_prepared_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t mult_polynomial_prepared_nonzero_with_zero_is_zero() {
+	//Arrange
+	uint64_t a[2] = {962478133025520, 1002369712026};
+	uint64_t zero[4] = {0, 0, 0, 0};
+	uint64_t prod[4];
+	prepared_multiplicand_t prepared;
+	
+	//Act
+	prepare_multiplicand(zero, 4, &prepared);
+	mult_polynomial_prepared(a, &prepared, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(zero, prod, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_prepared_nonzero_with_zero_is_zero FAILED";
+	return result;
+}
+
+void mult_polynomial_prepared_correctness_tests() {
+	eval_test(mult_polynomial_prepared_case());
+	eval_test(mult_polynomial_prepared_reused_crossreference_karatsuba());
+	eval_test(mult_polynomial_prepared_crossreference_shiftadd());
+	eval_test(mult_polynomial_prepared_nonzero_with_zero_is_zero());
+}
+
+/* ======================= mult_polynomial_holes =============== */
+
+result_t mult_polynomial_holes_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[4] = {0, 13, 20, 126};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {1, 20, 40, 50};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_ab[4];
+	uint64_t indicesab[14] = {1, 14, 20, 21, 33, 50, 53, 60, 63, 70, 127, 146, 166, 176};
+	index_to_polynomial(indicesab, 14, expected_ab, 4);
+	uint64_t ab[4];
+	
+	//Act
+	mult_polynomial_holes(a, b, ab);
+	
+	//Assert
+	bool correct = equal_polynomials(ab, expected_ab, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_holes_case FAILED";
+	return result;
+}
+
+result_t mult_polynomial_holes_all_ones() {
+	//Arrange, worst case for carries into the holes
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	
+	//Act
+	mult_polynomial_holes(a, a, ab0);
+	square_polynomial(a, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_holes_all_ones FAILED";
+	return result;
+}
+
+result_t mult_polynomial_holes_crossreference_karatsuba() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	bool correct = 1;
+	
+	for(int i = 0; i < 16; i++) {
+		rand_element(a);
+		rand_element(b);
+		
+		//Act
+		mult_polynomial_holes(a, b, ab0);
+		mult_karatsuba(a, b, ab1);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab1, 4);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_holes_crossreference_karatsuba FAILED";
+	return result;
+}
+
+result_t mult_polynomial_holes_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2] = {259398971125881, 98752520481};
+	uint64_t b[2] = {973025584, 89930471};
+	uint64_t ab0[4];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_polynomial_holes(a, b, ab0);
+	reduction_generic(ab0);
+	mult_shiftadd(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_holes_crossreference_shiftadd FAILED";
+	return result;
+}
+
+void mult_polynomial_holes_correctness_tests() {
+	eval_test(mult_polynomial_holes_case());
+	eval_test(mult_polynomial_holes_all_ones());
+	eval_test(mult_polynomial_holes_crossreference_karatsuba());
+	eval_test(mult_polynomial_holes_crossreference_shiftadd());
+}
+
+/* ======================= mult_polynomial_clmul =============== */
+
+result_t mult_polynomial_clmul_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[4] = {0, 13, 20, 126};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {1, 20, 40, 50};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_ab[4];
+	uint64_t indicesab[14] = {1, 14, 20, 21, 33, 50, 53, 60, 63, 70, 127, 146, 166, 176};
+	index_to_polynomial(indicesab, 14, expected_ab, 4);
+	uint64_t ab[4];
+	
+	//Act
+	mult_polynomial_clmul(a, b, ab);
+	
+	//Assert
+	bool correct = equal_polynomials(ab, expected_ab, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_clmul_case FAILED";
+	return result;
+}
+
+result_t mult_polynomial_clmul_not_modifying_operands() {
+	//Arrange
+	uint64_t a0[2] = {12529730, 896271426};
+	uint64_t a1[2] = {12529730, 896271426};
+	uint64_t b0[2] = {93478201365, 87966666};
+	uint64_t b1[2] = {93478201365, 87966666};
+	uint64_t ab[4];
+	
+	//Act
+	mult_polynomial_clmul(a1, b1, ab);
+	
+	//Assert
+	bool samea = equal_polynomials(a0, a1, 2);
+	bool sameb = equal_polynomials(b0, b1, 2);
+	
+	//Return
+	result_t result;
+	result.success = samea && sameb;
+	result.fail_msg = "mult_polynomial_clmul_not_modifying_operands FAILED";
+	return result;
+}
+
+result_t mult_polynomial_clmul_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2] = {259398971125881, 98752520481};
+	uint64_t b[2] = {973025584, 89930471};
+	uint64_t ab0[4];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_polynomial_clmul(a, b, ab0);
+	reduction_generic(ab0);
+	mult_shiftadd(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_clmul_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t mult_polynomial_clmul_crossreference_window8() {
+	//Arrange
+	uint64_t a[2] = {0x7FFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t b[2] = {0xFEDCBA9876543210, 0x4F1BBCDCBFA53E0A};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	
+	//Act
+	mult_polynomial_clmul(a, b, ab0);
+	mult_polynomial_lrcomb_window8(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_clmul_crossreference_window8 FAILED";
+	return result;
+}
+
+result_t mult_polynomial_clmul_crossreference_square() {
+	//Arrange
+	uint64_t a[2] = {4682043888526, 7512369852};
+	uint64_t aprod[4];
+	uint64_t asquare[4];
+	
+	//Act
+	mult_polynomial_clmul(a, a, aprod);
+	square_polynomial(a, asquare);
+	
+	//Assert
+	bool correct = equal_polynomials(aprod, asquare, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_clmul_crossreference_square FAILED";
+	return result;
+}
+
+result_t mult_polynomial_clmul_commutative() {
+	//Arrange
+	uint64_t a[2] = {67821035862049, 851586217803};
+	uint64_t b[2] = {8527932468052827, 784512058952025852};
+	uint64_t ab[4];
+	uint64_t ba[4];
+	
+	//Act
+	mult_polynomial_clmul(a, b, ab);
+	mult_polynomial_clmul(b, a, ba);
+	
+	//Assert
+	bool correct = equal_polynomials(ab, ba, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_clmul_commutative FAILED";
+	return result;
+}
+
+result_t mult_polynomial_crossreference_window8() {
+	//Arrange
+	uint64_t a[2] = {6234567985233, 18638245347};
+	uint64_t b[2] = {9087872, 2305473123560};
+	uint64_t ab0[4];
+	uint64_t ab1[4];
+	
+	//Act
+	mult_polynomial(a, b, ab0);
+	mult_polynomial_lrcomb_window8(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 4);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_polynomial_crossreference_window8 FAILED";
+	return result;
+}
+
+void mult_polynomial_clmul_correctness_tests() {
+	eval_test(mult_polynomial_crossreference_window8());
+	if(!cpu_supports_pclmul()) {
+		printf("\nPCLMULQDQ not supported, skipping mult_polynomial_clmul tests\n");
+		return;
+	}
+	eval_test(mult_polynomial_clmul_case());
+	eval_test(mult_polynomial_clmul_not_modifying_operands());
+	eval_test(mult_polynomial_clmul_crossreference_shiftadd());
+	eval_test(mult_polynomial_clmul_crossreference_window8());
+	eval_test(mult_polynomial_clmul_crossreference_square());
+	eval_test(mult_polynomial_clmul_commutative());
+}
+
+/* ======================= field_mul =============== */
+
+result_t field_mul_reduction_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[2] = {64, 119};
+	index_to_polynomial(indicesa, 2, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[3] = {7, 11, 13};
+	index_to_polynomial(indicesb, 3, b, 2);
+	uint64_t expected_ab[2];
+	uint64_t indicesab[8] = {3, 5, 66, 68, 71, 75, 77, 126};
+	index_to_polynomial(indicesab, 8, expected_ab, 2);
+	uint64_t ab[2];
+	
+	//Act
+	field_mul(a, b, ab);
+	
+	//Assert
+	bool correct = equal_polynomials(ab, expected_ab, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_reduction_case FAILED";
+	return result;
+}
+
+result_t field_mul_not_modifying_operands() {
+	//Arrange
+	uint64_t a0[2] = {12529730, 896271426};
+	uint64_t a1[2] = {12529730, 896271426};
+	uint64_t b0[2] = {93478201365, 87966666};
+	uint64_t b1[2] = {93478201365, 87966666};
+	uint64_t ab[2];
+	
+	//Act
+	field_mul(a1, b1, ab);
+	
+	//Assert
+	bool samea = equal_polynomials(a0, a1, 2);
+	bool sameb = equal_polynomials(b0, b1, 2);
+	
+	//Return
+	result_t result;
+	result.success = samea && sameb;
+	result.fail_msg = "field_mul_not_modifying_operands FAILED";
+	return result;
+}
+
+result_t field_mul_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	uint64_t ab2[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 16; i++) {
+		rand_element(a);
+		rand_element(b);
+		
+		//Act
+		field_mul_software(a, b, ab0);
+		field_mul(a, b, ab1);
+		mult_shiftadd(a, b, ab2);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab2, 2) && equal_polynomials(ab1, ab2, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t field_mul_max_degree_operands() {
+	//Arrange
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	uint64_t ab2[2];
+	
+	//Act
+	field_mul_software(a, a, ab0);
+	field_mul(a, a, ab1);
+	mult_shiftadd(a, a, ab2);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab2, 2) && equal_polynomials(ab1, ab2, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_max_degree_operands FAILED";
+	return result;
+}
+
+result_t field_mul_associative() {
+	//Arrange
+	uint64_t a[2] = {4982476259832, 782568945165680};
+	uint64_t b[2] = {87113654853248, 78845310568541};
+	uint64_t c[2] = {1678764890924356, 296794359344};
+	uint64_t ab[2];
+	uint64_t bc[2];
+	uint64_t abc0[2];
+	uint64_t abc1[2];
+	
+	//Act
+	field_mul(a, b, ab);
+	field_mul(ab, c, abc0);
+	field_mul(b, c, bc);
+	field_mul(a, bc, abc1);
+	
+	//Assert
+	bool correct = equal_polynomials(abc0, abc1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_associative FAILED";
+	return result;
+}
+
+result_t field_mul_nonzero_with_one_is_same() {
+	//Arrange
+	uint64_t a[2] = {331245254110210982, 127931};
+	uint64_t one[2] = {1, 0};
+	uint64_t prod[2];
+	
+	//Act
+	field_mul(a, one, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(a, prod, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_nonzero_with_one_is_same FAILED";
+	return result;
+}
+
+void field_mul_correctness_tests() {
+	eval_test(field_mul_reduction_case());
+	eval_test(field_mul_not_modifying_operands());
+	eval_test(field_mul_crossreference_shiftadd());
+	eval_test(field_mul_max_degree_operands());
+	eval_test(field_mul_associative());
+	eval_test(field_mul_nonzero_with_one_is_same());
+}
+
+/* ======================= mult_sparse & mult_monomial =============== */
+
+result_t mult_sparse_crossreference_field_mul() {
+	//Arrange
+	uint64_t a[2] = {0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+	uint64_t indices[6] = {0, 1, 63, 64, 100, 126};
+	uint64_t b[2];
+	index_to_polynomial(indices, 6, b, 2);
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_sparse(a, indices, 6, ab0);
+	field_mul(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_sparse_crossreference_field_mul FAILED";
+	return result;
+}
+
+result_t mult_sparse_with_r() {
+	//Arrange
+	uint64_t a[2] = {1935724302108, 485126568431};
+	uint64_t r[2] = {0x8000000000000001, 0};
+	uint64_t indices[2] = {0, 63};
+	uint64_t ar0[2];
+	uint64_t ar1[2];
+	
+	//Act
+	mult_sparse(a, indices, 2, ar0);
+	mult_shiftadd(a, r, ar1);
+	
+	//Assert
+	bool correct = equal_polynomials(ar0, ar1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_sparse_with_r FAILED";
+	return result;
+}
+
+result_t mult_monomial_small_k_crossreference_shiftadd() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t zk[2];
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	bool correct = 1;
+	rand_element(a);
+	
+	for(uint64_t k = 0; k <= 126; k++) {
+		//Act
+		mult_monomial(a, k, ab0);
+		index_to_polynomial(&k, 1, zk, 2);
+		mult_shiftadd(a, zk, ab1);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_monomial_small_k_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t mult_monomial_large_k_is_repeated_shift() {
+	//Arrange
+	uint64_t a[2] = {67821035862049, 851586217803};
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	memcpy(ab1, a, sizeof(a));
+	
+	//Act
+	mult_monomial(a, 1000, ab0);
+	for(int i = 0; i < 10; i++) {
+		mult_monomial(ab1, 100, ab1);
+	}
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_monomial_large_k_is_repeated_shift FAILED";
+	return result;
+}
+
+result_t mult_monomial_exponents_add() {
+	//Arrange
+	uint64_t a[2] = {4982476259832, 782568945165680};
+	uint64_t k1 = 0x8000000000000000;
+	uint64_t k2 = 0x123456789ABCDEF;
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_monomial(a, k1 + k2, ab0);
+	mult_monomial(a, k1, ab1);
+	mult_monomial(ab1, k2, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_monomial_exponents_add FAILED";
+	return result;
+}
+
+result_t mult_monomial_fold_and_table_agree_with_shifts() {
+	//Arrange
+	uint64_t a[2] = {5812375236741, 903457823461278};
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	memcpy(ab1, a, sizeof(a));
+	bool correct = 1;
+	
+	//Act & Assert
+	/* Steps of 37 cross from the shift to the fold and then the table */
+	for(uint64_t k = 0; k < 3000; k += 37) {
+		mult_monomial(a, k, ab0);
+		correct = correct && equal_polynomials(ab0, ab1, 2);
+		mult_monomial(ab1, 37, ab1);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_monomial_fold_and_table_agree_with_shifts FAILED";
+	return result;
+}
+
+void mult_sparse_correctness_tests() {
+	eval_test(mult_sparse_crossreference_field_mul());
+	eval_test(mult_sparse_with_r());
+	eval_test(mult_monomial_small_k_crossreference_shiftadd());
+	eval_test(mult_monomial_large_k_is_repeated_shift());
+	eval_test(mult_monomial_exponents_add());
+	eval_test(mult_monomial_fold_and_table_agree_with_shifts());
+}
+
+/* ======================= mult_batch =============== */
+
+result_t mult_batch_crossreference_shiftadd() {
+	//Arrange
+	uint64_t n = 11; // Not a multiple of 4, to cover the tail
+	uint64_t a[22];
+	uint64_t b[22];
+	uint64_t ab0[22];
+	uint64_t ab1[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+		rand_element(&b[2*i]);
+	}
+	
+	//Act
+	mult_batch(a, b, ab0, n);
+	
+	//Assert
+	bool correct = 1;
+	for(int i = 0; i < n; i++) {
+		mult_shiftadd(&a[2*i], &b[2*i], ab1);
+		correct = correct && equal_polynomials(&ab0[2*i], ab1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_batch_crossreference_shiftadd FAILED";
+	return result;
+}
+
+result_t mult_batch_max_degree_operands() {
+	//Arrange
+	uint64_t a[8] = {-1, 0x7FFFFFFFFFFFFFFF, -1, 0x7FFFFFFFFFFFFFFF,
+		1, 0, 0, 0x4000000000000000};
+	uint64_t b[8] = {-1, 0x7FFFFFFFFFFFFFFF, 0x8000000000000001, 0x4000000000000000,
+		-1, 0x7FFFFFFFFFFFFFFF, 0, 0x4000000000000000};
+	uint64_t ab0[8];
+	uint64_t ab1[2];
+	
+	//Act
+	mult_batch(a, b, ab0, 4);
+	
+	//Assert
+	bool correct = 1;
+	for(int i = 0; i < 4; i++) {
+		mult_shiftadd(&a[2*i], &b[2*i], ab1);
+		correct = correct && equal_polynomials(&ab0[2*i], ab1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_batch_max_degree_operands FAILED";
+	return result;
+}
+
+result_t mult_batch_kernels_agree() {
+	//Arrange
+	uint64_t n = 9;
+	uint64_t a[18];
+	uint64_t b[18];
+	uint64_t ab0[18];
+	uint64_t ab1[18];
+	uint64_t ab2[18];
+	uint64_t ab3[18];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+		rand_element(&b[2*i]);
+	}
+	
+	//Act
+	mult_batch_generic(a, b, ab0, n);
+	memcpy(ab1, ab0, sizeof(ab0));
+	memcpy(ab2, ab0, sizeof(ab0));
+	memcpy(ab3, ab0, sizeof(ab0));
+	if(cpu_supports_pclmul()) {
+		mult_batch_pclmul(a, b, ab1, n);
+	}
+	if(cpu_supports_vpclmul()) {
+		mult_batch_vpclmul(a, b, ab2, n);
+	}
+	if(cpu_supports_vpclmul_avx2()) {
+		mult_batch_vpclmul_avx2(a, b, ab3, n);
+	}
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 18) && equal_polynomials(ab0, ab2, 18);
+	correct = correct && equal_polynomials(ab0, ab3, 18);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_batch_kernels_agree FAILED";
+	return result;
+}
+
+result_t mult_batch_empty_batch() {
+	//Arrange
+	uint64_t a[2] = {5, 7};
+	uint64_t b[2] = {9, 11};
+	uint64_t c[2] = {13, 17};
+	uint64_t expected[2] = {13, 17};
+	
+	//Act
+	mult_batch(a, b, c, 0);
+	
+	//Assert
+	bool correct = equal_polynomials(c, expected, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "mult_batch_empty_batch FAILED";
+	return result;
+}
+
+void mult_batch_correctness_tests() {
+	eval_test(mult_batch_crossreference_shiftadd());
+	eval_test(mult_batch_max_degree_operands());
+	eval_test(mult_batch_kernels_agree());
+	eval_test(mult_batch_empty_batch());
+}
+
+/* ======================= field_square =============== */
+
+result_t field_square_crossreference_square_polynomial() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t square[4];
+	uint64_t c[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		rand_element(a);
+		
+		//Act
+		field_square(a, c);
+		square_polynomial(a, square);
+		reduction_generic(square);
+		
+		//Assert
+		correct = correct && equal_polynomials(c, square, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_square_crossreference_square_polynomial FAILED";
+	return result;
+}
+
+result_t field_square_kernels_agree() {
+	//Arrange
+	uint64_t a[2] = {-1, 0x7FFFFFFFFFFFFFFF};
+	uint64_t c0[2];
+	uint64_t c1[2];
+	uint64_t c2[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		//Act
+		field_square_software(a, c0);
+		memcpy(c1, c0, sizeof(c0));
+		memcpy(c2, c0, sizeof(c0));
+		if(cpu_supports_pclmul()) {
+			field_square_clmul(a, c1);
+		}
+		if(cpu_supports_bmi2()) {
+			field_square_pdep(a, c2);
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2) && equal_polynomials(c0, c2, 2);
+		rand_element(a);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_square_kernels_agree FAILED";
+	return result;
+}
+
+result_t field_square_in_place_equals_field_mul() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t aa[2];
+	rand_element(a);
+	
+	//Act
+	field_mul(a, a, aa);
+	field_square(a, a);
+	
+	//Assert
+	bool correct = equal_polynomials(a, aa, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_square_in_place_equals_field_mul FAILED";
+	return result;
+}
+
+result_t field_square_array_crossreference_field_square() {
+	//Arrange
+	uint64_t n = 7; // Odd, to cover the tail
+	uint64_t a[14];
+	uint64_t c0[14];
+	uint64_t c1[14];
+	uint64_t c2[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
+	
+	//Act
+	field_square_array(a, c0, n);
+	field_square_array_generic(a, c1, n);
+	
+	//Assert
+	bool correct = equal_polynomials(c0, c1, 14);
+	for(int i = 0; i < n; i++) {
+		field_square(&a[2*i], c2);
+		correct = correct && equal_polynomials(&c0[2*i], c2, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_square_array_crossreference_field_square FAILED";
+	return result;
+}
+
+result_t field_square_array_avx2_max_degree() {
+	//Arrange
+	uint64_t a[8] = {-1, 0x7FFFFFFFFFFFFFFF, 0, 0x4000000000000000,
+		0x8000000000000001, 0x4000000000000000, 1, 0};
+	uint64_t c0[8];
+	uint64_t c1[8];
+	
+	//Act
+	field_square_array_generic(a, c0, 4);
+	memcpy(c1, c0, sizeof(c0));
+	if(cpu_supports_avx2()) {
+		field_square_array_avx2(a, c1, 4);
+	}
+	
+	//Assert
+	bool correct = equal_polynomials(c0, c1, 8);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_square_array_avx2_max_degree FAILED";
+	return result;
+}
+
+void field_square_correctness_tests() {
+	eval_test(field_square_crossreference_square_polynomial());
+	eval_test(field_square_kernels_agree());
+	eval_test(field_square_in_place_equals_field_mul());
+	eval_test(field_square_array_crossreference_field_square());
+	eval_test(field_square_array_avx2_max_degree());
+}
+
+/* ======================= field_multisquare =============== */
+
+result_t field_multisquare_crossreference_square_polynomial() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t c[2];
+	uint64_t x[2];
+	uint64_t square[4];
+	bool correct = 1;
+	rand_element(a);
+	
+	for(uint64_t k = 0; k <= 126; k += 5) {
+		//Act
+		field_multisquare(a, k, c);
+		x[0] = a[0];
+		x[1] = a[1];
+		for(uint64_t i = 0; i < k; i++) {
+			square_polynomial(x, square);
+			reduction_generic(square);
+			x[0] = square[0];
+			x[1] = square[1];
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(c, x, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_multisquare_crossreference_square_polynomial FAILED";
+	return result;
+}
+
+result_t field_multisquare_table_equals_iterated() {
+	//Arrange
+	uint64_t a[2] = {-1, 0x7FFFFFFFFFFFFFFF};
+	uint64_t c0[2];
+	uint64_t c1[2];
+	bool correct = 1;
+	
+	for(uint64_t k = 0; k <= 126; k++) {
+		//Act
+		field_multisquare_iterated(a, k, c0);
+		field_multisquare_table(a, k, c1);
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2);
+		rand_element(a);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_multisquare_table_equals_iterated FAILED";
+	return result;
+}
+
+result_t field_multisquare_127_is_identity() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t c0[2];
+	uint64_t c1[2];
+	rand_element(a);
+	
+	//Act
+	field_multisquare(a, 127, c0);
+	field_multisquare_iterated(a, 127, c1);
+	
+	//Assert
+	bool correct = equal_polynomials(a, c0, 2) && equal_polynomials(a, c1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_multisquare_127_is_identity FAILED";
+	return result;
+}
+
+result_t field_multisquare_exponents_add() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t c0[2];
+	uint64_t c1[2];
+	rand_element(a);
+	
+	//Act
+	field_multisquare(a, 30, c0);
+	field_multisquare(c0, 33, c0);
+	field_multisquare(a, 63, c1);
+	
+	//Assert
+	bool correct = equal_polynomials(c0, c1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_multisquare_exponents_add FAILED";
+	return result;
+}
+
+void field_multisquare_correctness_tests() {
+	eval_test(field_multisquare_crossreference_square_polynomial());
+	eval_test(field_multisquare_table_equals_iterated());
+	eval_test(field_multisquare_127_is_identity());
+	eval_test(field_multisquare_exponents_add());
+}
+
+/* ======================= field_sqrt =============== */
+
+result_t field_sqrt_squared_crossreference_square_polynomial() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t root[2];
+	uint64_t square[4];
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		rand_element(a);
+		
+		//Act
+		field_sqrt(a, root);
+		square_polynomial(root, square);
+		reduction_generic(square);
+		
+		//Assert
+		correct = correct && equal_polynomials(a, square, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_sqrt_squared_crossreference_square_polynomial FAILED";
+	return result;
+}
+
+result_t field_sqrt_of_square_is_same() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t square[4];
+	uint64_t root[2];
+	rand_element(a);
+	
+	//Act
+	square_polynomial(a, square);
+	reduction_generic(square);
+	field_sqrt(square, root);
+	
+	//Assert
+	bool correct = equal_polynomials(a, root, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_sqrt_of_square_is_same FAILED";
+	return result;
+}
+
+result_t field_sqrt_of_z() {
+	//Arrange
+	uint64_t z[2] = {2, 0};
+	uint64_t expected[2] = {0x100000000, 1}; // z^64 + z^32
+	uint64_t root[2];
+	
+	//Act
+	field_sqrt(z, root);
+	
+	//Assert
+	bool correct = equal_polynomials(root, expected, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_sqrt_of_z FAILED";
+	return result;
+}
+
+result_t field_sqrt_kernels_agree_with_126_squarings() {
+	//Arrange
+	uint64_t a[2] = {-1, 0x7FFFFFFFFFFFFFFF};
+	uint64_t c0[2];
+	uint64_t c1[2];
+	uint64_t c2[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		//Act
+		field_multisquare_iterated(a, 126, c0);
+		field_sqrt_software(a, c1);
+		memcpy(c2, c1, sizeof(c1));
+		if(cpu_supports_bmi2()) {
+			field_sqrt_pext(a, c2);
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2) && equal_polynomials(c0, c2, 2);
+		rand_element(a);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_sqrt_kernels_agree_with_126_squarings FAILED";
+	return result;
+}
+
+void field_sqrt_correctness_tests() {
+	eval_test(field_sqrt_squared_crossreference_square_polynomial());
+	eval_test(field_sqrt_of_square_is_same());
+	eval_test(field_sqrt_of_z());
+	eval_test(field_sqrt_kernels_agree_with_126_squarings());
+}
+
+/* ======================= redundant representation =============== */
+
+result_t field_mul_lazy_chain_canonicalizes_to_field_mul() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t x0[2];
+	uint64_t x1[2];
+	uint64_t canonical[2];
+	rand_element(a);
+	rand_element(b);
+	x0[0] = x1[0] = a[0];
+	x0[1] = x1[1] = a[1];
+	
+	//Act
+	for(int i = 0; i < 100; i++) {
+		field_mul(x0, b, x0);
+		field_square(x0, x0);
+		field_mul_lazy(x1, b, x1);
+		field_square_lazy(x1, x1);
+	}
+	field_canonicalize(x1, canonical);
+	
+	//Assert
+	bool correct = equal_polynomials(x0, canonical, 2) && field_equal(x0, x1);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_lazy_chain_canonicalizes_to_field_mul FAILED";
+	return result;
+}
+
+result_t field_mul_lazy_degree_127_operands() {
+	//Arrange
+	uint64_t a[2] = {-1, -1};
+	uint64_t b[2];
+	uint64_t f[2] = {0x8000000000000001, 0x8000000000000000}; // Represents zero
+	uint64_t zero[2] = {0, 0};
+	uint64_t ca[2];
+	uint64_t cb[2];
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	uint64_t ab2[2];
+	uint64_t af[2];
+	rand_element(b);
+	b[1] |= 0x8000000000000000;
+	field_canonicalize(a, ca);
+	field_canonicalize(b, cb);
+	
+	//Act
+	field_mul_lazy(a, b, ab0);
+	field_mul(a, b, ab1);
+	field_mul(ca, cb, ab2);
+	field_mul_lazy(a, f, af);
+	
+	//Assert
+	bool correct = field_equal(ab0, ab2) && equal_polynomials(ab1, ab2, 2)
+		&& (ab1[1] >> 63) == 0 && field_equal(af, zero);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_mul_lazy_degree_127_operands FAILED";
+	return result;
+}
+
+result_t field_lazy_kernels_agree() {
+	//Arrange
+	uint64_t a[2] = {-1, -1};
+	uint64_t b[2] = {-1, -1};
+	uint64_t c0[2];
+	uint64_t c1[2];
+	uint64_t s0[2];
+	uint64_t s1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		//Act
+		field_mul_lazy_software(a, b, c0);
+		field_square_lazy_software(a, s0);
+		memcpy(c1, c0, sizeof(c0));
+		memcpy(s1, s0, sizeof(s0));
+		if(cpu_supports_pclmul()) {
+			field_mul_lazy_clmul(a, b, c1);
+			field_square_lazy_clmul(a, s1);
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2) && equal_polynomials(s0, s1, 2);
+		rand_element(a);
+		rand_element(b);
+		a[1] |= (uint64_t) (i % 2) << 63;
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_lazy_kernels_agree FAILED";
+	return result;
+}
+
+result_t field_equal_on_representatives() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t a_plus_f[2];
+	uint64_t b[2];
+	rand_element(a);
+	a_plus_f[0] = a[0] ^ 0x8000000000000001;
+	a_plus_f[1] = a[1] ^ 0x8000000000000000;
+	b[0] = a[0] ^ 1;
+	b[1] = a[1];
+	
+	//Act
+	bool equal = field_equal(a, a_plus_f);
+	bool not_equal = field_equal(a_plus_f, b);
+	
+	//Assert
+	bool correct = equal && !not_equal;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_equal_on_representatives FAILED";
+	return result;
+}
+
+void field_lazy_correctness_tests() {
+	eval_test(field_mul_lazy_chain_canonicalizes_to_field_mul());
+	eval_test(field_mul_lazy_degree_127_operands());
+	eval_test(field_lazy_kernels_agree());
+	eval_test(field_equal_on_representatives());
+}
+
+/* ======================= field contexts =============== */
+
+int field_ms[6] = {127, 163, 233, 283, 409, 571};
+
+/* Bit-serial reference, c = a*b mod f by Horner's rule over the bits of b */
+void field_ctx_mult_bitserial(field_t * ctx, uint64_t * a, uint64_t * b, uint64_t * c) {
+	uint64_t acc[FIELD_MAX_WORDS] = {0};
+	int len = ctx->len;
+	for(int i = ctx->m - 1; i >= 0; i--) {
+		for(int w = len - 1; w > 0; w--) {
+			acc[w] = (acc[w] << 1) | (acc[w-1] >> 63);
+		}
+		acc[0] <<= 1;
+		if((acc[ctx->m / 64] >> (ctx->m % 64)) & 1) {
+			for(int w = 0; w < len; w++) {
+				acc[w] ^= ctx->f[w];
+			}
+		}
+		if((b[i / 64] >> (i % 64)) & 1) {
+			for(int w = 0; w < len; w++) {
+				acc[w] ^= a[w];
+			}
+		}
+	}
+	memcpy(c, acc, sizeof(uint64_t)*len);
+}
+
+result_t field_ctx_mult_crossreference_bitserial() {
+	//Arrange
+	uint64_t a[FIELD_MAX_WORDS];
+	uint64_t b[FIELD_MAX_WORDS];
+	uint64_t ab0[FIELD_MAX_WORDS];
+	uint64_t ab1[FIELD_MAX_WORDS];
+	bool correct = 1;
+	
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(field_ms[k]);
+		for(int i = 0; i < 10; i++) {
+			field_ctx_rand_element(ctx, a);
+			field_ctx_rand_element(ctx, b);
+			
+			//Act
+			field_ctx_mult(ctx, a, b, ab0);
+			field_ctx_mult_bitserial(ctx, a, b, ab1);
+			
+			//Assert
+			correct = correct && equal_polynomials(ab0, ab1, ctx->len);
+		}
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_mult_crossreference_bitserial FAILED";
+	return result;
+}
+
+result_t field_ctx_mult_max_degree_operands() {
+	//Arrange
+	uint64_t a[FIELD_MAX_WORDS];
+	uint64_t ab0[FIELD_MAX_WORDS];
+	uint64_t ab1[FIELD_MAX_WORDS];
+	bool correct = 1;
+	
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(field_ms[k]);
+		for(int w = 0; w < ctx->len; w++) {
+			a[w] = -1;
+		}
+		a[ctx->len - 1] = ((uint64_t) 1 << (ctx->m % 64)) - 1;
+		
+		//Act
+		field_ctx_mult(ctx, a, a, ab0);
+		field_ctx_mult_bitserial(ctx, a, a, ab1);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab1, ctx->len);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_mult_max_degree_operands FAILED";
+	return result;
+}
+
+result_t field_ctx_square_equals_mult() {
+	//Arrange
+	uint64_t a[FIELD_MAX_WORDS];
+	uint64_t aa0[FIELD_MAX_WORDS];
+	uint64_t aa1[FIELD_MAX_WORDS];
+	bool correct = 1;
+	
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(field_ms[k]);
+		field_ctx_rand_element(ctx, a);
+		
+		//Act
+		field_ctx_square(ctx, a, aa0);
+		field_ctx_mult(ctx, a, a, aa1);
+		
+		//Assert
+		correct = correct && equal_polynomials(aa0, aa1, ctx->len);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_square_equals_mult FAILED";
+	return result;
+}
+
+result_t field_ctx_inv_product_is_one() {
+	//Arrange
+	uint64_t a[FIELD_MAX_WORDS];
+	uint64_t inv_a[FIELD_MAX_WORDS];
+	uint64_t prod[FIELD_MAX_WORDS];
+	uint64_t one[FIELD_MAX_WORDS] = {1};
+	bool correct = 1;
+	
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(field_ms[k]);
+		for(int i = 0; i < 5; i++) {
+			field_ctx_rand_element(ctx, a);
+			
+			//Act
+			field_ctx_inv(ctx, a, inv_a);
+			field_ctx_mult(ctx, a, inv_a, prod);
+			
+			//Assert
+			correct = correct && equal_polynomials(prod, one, ctx->len);
+		}
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_inv_product_is_one FAILED";
+	return result;
+}
+
+result_t field_ctx_reduce_z_to_m_is_r() {
+	//Arrange
+	uint64_t c[2*FIELD_MAX_WORDS];
+	uint64_t expected[FIELD_MAX_WORDS];
+	bool correct = 1;
+	
+	for(int k = 0; k < 6; k++) {
+		field_t * ctx = field_get(field_ms[k]);
+		memset(c, 0, sizeof(uint64_t)*2*ctx->len);
+		c[ctx->m / 64] = (uint64_t) 1 << (ctx->m % 64);
+		memcpy(expected, ctx->f, sizeof(uint64_t)*ctx->len);
+		expected[ctx->m / 64] ^= c[ctx->m / 64];
+		
+		//Act
+		field_ctx_reduce(ctx, c);
+		
+		//Assert
+		correct = correct && equal_polynomials(c, expected, ctx->len);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_reduce_z_to_m_is_r FAILED";
+	return result;
+}
+
+result_t field_ctx_127_agrees_with_field_mul() {
+	//Arrange
+	field_t * ctx = field_get(127);
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	rand_element(a);
+	rand_element(b);
+	
+	//Act
+	field_ctx_mult(ctx, a, b, ab0);
+	field_mul(a, b, ab1);
+	
+	//Assert
+	bool correct = equal_polynomials(ab0, ab1, 2) && ctx->len == 2;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_ctx_127_agrees_with_field_mul FAILED";
+	return result;
+}
+
+result_t field_init_rejects_unsupported() {
+	//Arrange
+	field_t ctx;
+	int terms_large_m[2] = {1, 0};
+	int terms_large_term[2] = {120, 0};
+	
+	//Act
+	bool too_many_words = field_init(&ctx, 600, terms_large_m, 2);
+	bool term_too_high = field_init(&ctx, 163, terms_large_term, 2);
+	
+	//Assert
+	bool correct = !too_many_words && !term_too_high && field_get(131) == NULL;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_init_rejects_unsupported FAILED";
+	return result;
+}
+
+/* Dense irreducible polynomials of degree 127 (65 terms) and 128 (61 terms) */
+uint64_t dense_f127[3] = {0x2bcd474348edfdbf, 0xe06eb671008c5d11, 0};
+uint64_t dense_f128[3] = {0x75f6e08d00d8ede3, 0x25606e6b0fc8a103, 1};
+
+result_t field_barrett_dense_crossreference_bitserial() {
+	//Arrange
+	field_t ctx127;
+	field_t ctx128;
+	field_init_barrett(&ctx127, 127, dense_f127);
+	field_init_barrett(&ctx128, 128, dense_f128);
+	field_t * ctxs[2] = {&ctx127, &ctx128};
+	uint64_t a[3];
+	uint64_t b[3];
+	uint64_t ab0[3];
+	uint64_t ab1[3];
+	uint64_t aa0[3];
+	uint64_t aa1[3];
+	bool correct = 1;
+	
+	for(int k = 0; k < 2; k++) {
+		for(int i = 0; i < 20; i++) {
+			field_ctx_rand_element(ctxs[k], a);
+			field_ctx_rand_element(ctxs[k], b);
+			
+			//Act
+			field_ctx_mult(ctxs[k], a, b, ab0);
+			field_ctx_mult_bitserial(ctxs[k], a, b, ab1);
+			field_ctx_square(ctxs[k], a, aa0);
+			field_ctx_mult_bitserial(ctxs[k], a, a, aa1);
+			
+			//Assert
+			correct = correct && equal_polynomials(ab0, ab1, ctxs[k]->len)
+				&& equal_polynomials(aa0, aa1, ctxs[k]->len);
+		}
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_barrett_dense_crossreference_bitserial FAILED";
+	return result;
+}
+
+result_t field_barrett_trinomial_agrees_with_field_mul() {
+	//Arrange
+	field_t ctx;
+	int terms[2] = {63, 0};
+	field_init(&ctx, 127, terms, 2);
+	bool switched = field_set_reduction(&ctx, FIELD_REDUCTION_BARRETT);
+	uint64_t a[2] = {-1, 0x7FFFFFFFFFFFFFFF};
+	uint64_t b[2] = {-1, 0x7FFFFFFFFFFFFFFF};
+	uint64_t ab0[2];
+	uint64_t ab1[2];
+	bool correct = switched;
+	
+	for(int i = 0; i < 20; i++) {
+		//Act
+		field_ctx_mult(&ctx, a, b, ab0);
+		field_mul(a, b, ab1);
+		
+		//Assert
+		correct = correct && equal_polynomials(ab0, ab1, 2);
+		rand_element(a);
+		rand_element(b);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_barrett_trinomial_agrees_with_field_mul FAILED";
+	return result;
+}
+
+result_t field_barrett_inv_product_is_one() {
+	//Arrange
+	field_t ctx;
+	field_init_barrett(&ctx, 128, dense_f128);
+	uint64_t a[3];
+	uint64_t inv_a[3];
+	uint64_t prod[3];
+	uint64_t one[3] = {1, 0, 0};
+	field_ctx_rand_element(&ctx, a);
+	
+	//Act
+	field_ctx_inv(&ctx, a, inv_a);
+	field_ctx_mult(&ctx, a, inv_a, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(prod, one, 3);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_barrett_inv_product_is_one FAILED";
+	return result;
+}
+
+result_t field_set_reduction_rejects_unsupported() {
+	//Arrange
+	field_t dense;
+	field_t nist163 = *field_get(163);
+	field_init_barrett(&dense, 127, dense_f127);
+	
+	//Act
+	bool barrett_163 = field_set_reduction(&nist163, FIELD_REDUCTION_BARRETT);
+	bool sparse_dense = field_set_reduction(&dense, FIELD_REDUCTION_SPARSE);
+	
+	//Assert
+	bool correct = !barrett_163 && !sparse_dense && dense.reduction == FIELD_REDUCTION_BARRETT;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_set_reduction_rejects_unsupported FAILED";
+	return result;
+}
+
+result_t field_set_reduction_restores_specialized_kernels() {
+	//Arrange
+	field_t field127 = *field_get(127);
+	field_t nist163 = *field_get(163);
+	
+	//Act
+	field_set_reduction(&field127, FIELD_REDUCTION_BARRETT);
+	field_set_reduction(&field127, FIELD_REDUCTION_SPARSE);
+	field_set_reduction(&nist163, FIELD_REDUCTION_SPARSE);
+	
+	//Assert
+	field_t * shared127 = field_get(127);
+	bool correct = field127.mult == shared127->mult && field127.square == shared127->square;
+	correct = correct && field127.reduce == shared127->reduce && field127.inv == shared127->inv;
+	correct = correct && nist163.reduce == field_get(163)->reduce;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_set_reduction_restores_specialized_kernels FAILED";
+	return result;
+}
+
+void field_ctx_correctness_tests() {
+	eval_test(field_ctx_mult_crossreference_bitserial());
+	eval_test(field_ctx_mult_max_degree_operands());
+	eval_test(field_ctx_square_equals_mult());
+	eval_test(field_ctx_inv_product_is_one());
+	eval_test(field_ctx_reduce_z_to_m_is_r());
+	eval_test(field_ctx_127_agrees_with_field_mul());
+	eval_test(field_init_rejects_unsupported());
+	eval_test(field_barrett_dense_crossreference_bitserial());
+	eval_test(field_barrett_trinomial_agrees_with_field_mul());
+	eval_test(field_barrett_inv_product_is_one());
+	eval_test(field_set_reduction_rejects_unsupported());
+	eval_test(field_set_reduction_restores_specialized_kernels());
+}
+
+/* =======================extended_euclid ============================== */
+
+result_t extended_euclid_coprime_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[3] = {0, 3, 40};
+	index_to_polynomial(indicesa, 3, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[2] = {2, 83};
+	index_to_polynomial(indicesb, 2, b, 2);
+	uint64_t expected_gcd[2] = {1, 0};
+	uint64_t expected_g[2];
+	uint64_t indicesg[43] = {0, 2, 3, 5, 6, 7, 9, 12, 14, 15, 19, 20, 22, 23, 24, 25, 27, 28, 30, 32, 33, 35, 36, 39, 41, 43, 44, 45, 48, 49, 51, 55, 58, 59, 60, 61, 65, 67, 72, 73, 79, 81, 82};
+	index_to_polynomial(indicesg, 46, expected_g, 2);
+	uint64_t expected_h[2];
+	uint64_t indicesh[16] = {0, 5, 6, 8, 12, 15, 16, 17, 18, 22, 24, 29, 30, 36, 38, 39};
+	index_to_polynomial(indicesh, 17, expected_h, 2);
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	extended_euclid(a, b, gcd, g, h);
+	
+	//Assert
+	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
+	bool correct_g = equal_polynomials(g, expected_g, 2);
+	bool correct_h = equal_polynomials(h, expected_h, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct_gcd && correct_g && correct_h;
+	result.fail_msg = "extended_euclid_coprime_case FAILED";
+	return result;
+}
+
+result_t extended_euclid_common_factor_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[4] = {1, 2, 4, 5};
+	index_to_polynomial(indicesa, 4, a, 2);
+	uint64_t b[2];
+	uint64_t indicesb[4] = {3, 4, 5, 6};
+	index_to_polynomial(indicesb, 4, b, 2);
+	uint64_t expected_gcd[2];
+	uint64_t indicesgcd[2] = {1, 3};
+	index_to_polynomial(indicesgcd, 2, expected_gcd, 2);
+	uint64_t expected_g[2];
+	uint64_t indicesg[3] = {0, 1, 2};
+	index_to_polynomial(indicesg, 3, expected_g, 2);
+	uint64_t expected_h[2];
+	uint64_t indicesh[2] = {0, 1};
+	index_to_polynomial(indicesh, 2, expected_h, 2);
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	extended_euclid(a, b, gcd, g, h);
+	
+	//Assert
+	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
+	bool correct_g = equal_polynomials(g, expected_g, 2);
+	bool correct_h = equal_polynomials(h, expected_h, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct_gcd && correct_g && correct_h;
+	result.fail_msg = "extended_euclid_common_factor_case FAILED";
+	return result;
+}
+
+result_t extended_euclid_cross_reference_g_and_h() {
+	//Arrange
+	uint64_t a[2] = {528723069, 9831505791};
+	uint64_t b[2] = {120687981035, 8412205886};
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	uint64_t ag[2];
+	uint64_t bh[2];
+	uint64_t sum[2];
+	
+	//Act
+	extended_euclid(a, b, gcd, g, h);
+	field_mul(a, g, ag);
+	field_mul(b, h, bh);
+	add(ag, bh, sum);
+	
+	//Assert
+	bool correct = equal_polynomials(sum, gcd, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "extended_euclid_cross_reference_g_and_h FAILED";
+	return result;
+}
+
+result_t extended_euclid_not_modifying_operands() {
+	//Arrange
+	uint64_t a0[2] = {252242103978283, 7892013649722};
+	uint64_t a1[2] = {252242103978283, 7892013649722};
+	uint64_t b0[2] = {710369852471, 3028945612774};
+	uint64_t b1[2] = {710369852471, 3028945612774};
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	extended_euclid(a1, b1, gcd, g, h);
+	
+	//Assert
+	bool samea = equal_polynomials(a0, a1, 2);
+	bool sameb = equal_polynomials(b0, b1, 2);
+	
+	//Return
+	result_t result;
+	result.success = samea && sameb;
+	result.fail_msg = "extended_euclid_not_modifying_operands FAILED";
+	return result;
+}
+
+result_t extended_euclid_one_with_nonzero_has_gcd_one() {
+	//Arrange
+	uint64_t one[2] = {1, 0};
+	uint64_t b[2] = {7645869580749671, 758135679};
+	uint64_t expected_gcd[2] = {1, 0};
+	uint64_t expected_g[2] = {1, 0};
+	uint64_t expected_h[2] = {0, 0};
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	extended_euclid(one, b, gcd, g, h);
+	
+	//Assert
+	bool correct_gcd = equal_polynomials(gcd, expected_gcd, 2);
+	bool correct_g = equal_polynomials(g, expected_g, 2);
+	bool correct_h = equal_polynomials(h, expected_h, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct_gcd && correct_g && correct_h;
+	result.fail_msg = "extended_euclid_one_with_nonzero_has_gcd_one FAILED";
+	return result;
+}
+
+void extended_euclid_correctness_tests() {
+	eval_test(extended_euclid_coprime_case());
+	eval_test(extended_euclid_common_factor_case());
+	eval_test(extended_euclid_cross_reference_g_and_h());
+	eval_test(extended_euclid_not_modifying_operands());
+	eval_test(extended_euclid_one_with_nonzero_has_gcd_one());
+}
+
+/* ================================ inv_euclid ================================ */
+
+result_t inv_euclid_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[3] = {126};
+	index_to_polynomial(indicesa, 3, a, 2);
+	uint64_t expected_inva[2];
+	uint64_t indicesinva[3] = {0, 1, 64};
+	index_to_polynomial(indicesinva, 3, expected_inva, 2);
+	uint64_t inva[2];
+	
+	//Act
+	inv_euclid(a, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, expected_inva, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_euclid_case FAILED";
+	return result;
+}
+
+result_t inv_euclid_not_modifying_operand() {
+	//Arrange
+	uint64_t a0[2] = {18820369423762, 77812309820}; 
+	uint64_t a1[2] = {18820369423762, 77812309820}; 
+	uint64_t inva[2];
+	
+	//Act
+	inv_euclid(a1, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(a0, a1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_euclid_not_modifying_operands FAILED";
+	return result;
+}
+
+result_t inv_euclid_crossreference_extended_euclid() {
+	//Arrange
+	uint64_t a[2] = {68791025222456, 910257638};
+	uint64_t f[2];
+	uint64_t indicesf[3] = {0, 63, 127};
+	index_to_polynomial(indicesf, 3, f, 2);
+	uint64_t inva[2];
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	inv_euclid(a, inva);
+	extended_euclid(a, f, gcd, g, h);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, g, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_euclid_crossreference_extended_euclid FAILED";
+	return result;
+}
+
+result_t inv_euclid_product_of_inverses_is_inverse_of_product() {
+	//Arrange
+	uint64_t a[2] = {25846057920451, 2468420775};
+	uint64_t b[2] = {31148700972, 7201781698};
+	uint64_t ab[2];
+	uint64_t inva[2];
+	uint64_t invb[2];
+	uint64_t inva_times_invb[2];
+	uint64_t prod[2];
+	uint64_t one[2] = {1, 0};
+	
+	//Act
+	field_mul(a, b, ab);
+	inv_euclid(a, inva);
+	inv_euclid(b, invb);
+	field_mul(inva, invb, inva_times_invb);
+	field_mul(ab, inva_times_invb, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(prod, one, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_euclid_product_of_inverses_is_inverse_of_product FAILED";
+	return result;
+}
+
+void inv_euclid_correctness_tests() {
+	eval_test(inv_euclid_case());
+	eval_test(inv_euclid_not_modifying_operand());
+	eval_test(inv_euclid_crossreference_extended_euclid());
+	eval_test(inv_euclid_product_of_inverses_is_inverse_of_product());
+}
+
+/* =================== inv_binary ========================= */
+
+result_t inv_binary_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[2] = {1, 64};
+	index_to_polynomial(indicesa, 2, a, 2);
+	uint64_t expected_inva[2];
+	uint64_t indicesinva[3] = {61, 125, 126};
+	index_to_polynomial(indicesinva, 3, expected_inva, 2);
+	uint64_t inva[2];
+	
+	//Act
+	inv_binary(a, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, expected_inva, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_binary_case FAILED";
+	return result;
+}
+
+result_t inv_binary_not_modifying_operand() {
+	//Arrange
+	uint64_t a0[2] = {711032552186, 801382846842977};
+	uint64_t a1[2] = {711032552186, 801382846842977};
+	uint64_t inva[2];
+	
+	//Act
+	inv_binary(a1, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(a0, a1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_binary_not_modifying_operand FAILED";
+	return result;
+}
+
+result_t inv_binary_crossreference_extended_euclid() {
+	//Arrange
+	uint64_t a[2] = {5489300711, 9782012354};
+	uint64_t f[2];
+	uint64_t indicesf[3] = {0, 63, 127};
+	index_to_polynomial(indicesf, 3, f, 2);
+	uint64_t inva[2];
+	uint64_t gcd[2];
+	uint64_t g[2];
+	uint64_t h[2];
+	
+	//Act
+	inv_binary(a, inva);
+	extended_euclid(a, f, gcd, g, h);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, g, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_binary_crossreference_extended_euclid FAILED";
+	return result;
+}
+
+result_t inv_binary_crossreference_inv_euclid() {
+	//Arrange
+	uint64_t a[2] = {469820358228, 972302255};
+	uint64_t inva0[2];
+	uint64_t inva1[2];
+	
+	//Act
+	inv_binary(a, inva0);
+	inv_euclid(a, inva1);
+	
+	//Assert
+	bool correct = equal_polynomials(inva0, inva1, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_binary_crossreference_inv_euclid FAILED";
+	return result;
+}
+
+result_t inv_binary_product_of_inverses_is_inverse_of_product() {
+	//Arrange
+	uint64_t a[2] = {3790115856821, 403885642179};
+	uint64_t b[2] = {617459943, 942720364782};
+	uint64_t ab[2];
+	uint64_t inva[2];
+	uint64_t invb[2];
+	uint64_t inva_times_invb[2];
+	uint64_t prod[2];
+	uint64_t one[2] = {1, 0};
+	
+	//Act
+	field_mul(a, b, ab);
+	inv_binary(a, inva);
+	inv_binary(b, invb);
+	field_mul(inva, invb, inva_times_invb);
+	field_mul(ab, inva_times_invb, prod);
+	
+	//Assert
+	bool correct = equal_polynomials(prod, one, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_binary_product_of_inverses_is_inverse_of_product FAILED";
+	return result;
+}
+
+void inv_binary_correctness_tests() {
+	eval_test(inv_binary_case());
+	eval_test(inv_binary_not_modifying_operand());
+	eval_test(inv_binary_crossreference_extended_euclid());
+	eval_test(inv_binary_crossreference_inv_euclid());
+	eval_test(inv_binary_product_of_inverses_is_inverse_of_product());
+}
+
+/* ======================= inv_almost_inverse ============================== */
+
+result_t inv_almost_inverse_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[2] = {1, 64};
+	index_to_polynomial(indicesa, 2, a, 2);
+	uint64_t expected_inva[2];
+	uint64_t indicesinva[3] = {61, 125, 126};
+	index_to_polynomial(indicesinva, 3, expected_inva, 2);
+	uint64_t inva[2];
+	
+	//Act
+	inv_almost_inverse(a, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, expected_inva, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_almost_inverse_case FAILED";
+	return result;
+}
+
+result_t inv_almost_inverse_crossreference_inv_euclid() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t inva0[2];
+	uint64_t inva1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 200; i++) {
+		rand_element(a);
+		if(a[0] == 0 && a[1] == 0) {
+			a[0] = 1;
+		}
+		
+		//Act
+		inv_almost_inverse(a, inva0);
+		inv_euclid(a, inva1);
+		
+		//Assert
+		correct = correct && equal_polynomials(inva0, inva1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_almost_inverse_crossreference_inv_euclid FAILED";
+	return result;
+}
+
+result_t inv_almost_inverse_monomials() {
+	//Arrange
+	uint64_t one[2] = {1, 0};
+	bool correct = 1;
+	
+	for(int i = 0; i < 127; i++) {
+		uint64_t a[2] = {0, 0};
+		a[i / 64] = (uint64_t) 1 << (i % 64);
+		uint64_t inva[2];
+		uint64_t prod[2];
+		
+		//Act
+		inv_almost_inverse(a, inva);
+		field_mul(a, inva, prod);
+		
+		//Assert
+		correct = correct && equal_polynomials(prod, one, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_almost_inverse_monomials FAILED";
+	return result;
+}
+
+void inv_almost_inverse_correctness_tests() {
+	eval_test(inv_almost_inverse_case());
+	eval_test(inv_almost_inverse_crossreference_inv_euclid());
+	eval_test(inv_almost_inverse_monomials());
+}
+
+/* ======================= field_div ============================== */
+
+result_t div_monomial_inverts_mult_monomial() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t shifted[2];
+	uint64_t c[2];
+	bool correct = 1;
+	rand_element(a);
+	
+	for(int k = 0; k < 300; k += 7) {
+		//Act
+		mult_monomial(a, k, shifted);
+		div_monomial(shifted, k, c);
+		
+		//Assert
+		correct = correct && equal_polynomials(c, a, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "div_monomial_inverts_mult_monomial FAILED";
+	return result;
+}
+
+result_t field_div_crossreference_inv_euclid() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t inva[2];
+	uint64_t expected[2];
+	uint64_t c[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 200; i++) {
+		rand_element(a);
+		rand_element(b);
+		if(a[0] == 0 && a[1] == 0) {
+			a[0] = 1;
+		}
+		
+		//Act
+		field_div(b, a, c);
+		inv_euclid(a, inva);
+		field_mul(b, inva, expected);
+		
+		//Assert
+		correct = correct && equal_polynomials(c, expected, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_div_crossreference_inv_euclid FAILED";
+	return result;
+}
+
+result_t field_div_edge_cases() {
+	//Arrange
+	uint64_t one[2] = {1, 0};
+	uint64_t zero[2] = {0, 0};
+	uint64_t a[2];
+	uint64_t b[2];
+	rand_element(a);
+	rand_element(b);
+	a[0] |= 1;
+	uint64_t by_one[2];
+	uint64_t by_self[2];
+	uint64_t of_zero[2];
+	
+	//Act
+	field_div(b, one, by_one);
+	field_div(a, a, by_self);
+	field_div(zero, a, of_zero);
+	
+	//Assert
+	bool correct = equal_polynomials(by_one, b, 2) && equal_polynomials(by_self, one, 2)
+		&& equal_polynomials(of_zero, zero, 2);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_div_edge_cases FAILED";
+	return result;
+}
+
+result_t field_div_almost_inverse_crossreference_field_div() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t b[2];
+	uint64_t c0[2];
+	uint64_t c1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 200; i++) {
+		rand_element(a);
+		rand_element(b);
+		a[0] |= 1;
+		
+		//Act
+		field_div(b, a, c0);
+		field_div_almost_inverse(b, a, c1);
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_div_almost_inverse_crossreference_field_div FAILED";
+	return result;
+}
+
+void field_div_correctness_tests() {
+	eval_test(div_monomial_inverts_mult_monomial());
+	eval_test(field_div_crossreference_inv_euclid());
+	eval_test(field_div_edge_cases());
+	eval_test(field_div_almost_inverse_crossreference_field_div());
+}
+
+/* ======================= inv_itoh_tsujii ============================== */
+
+result_t inv_itoh_tsujii_case() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t indicesa[2] = {1, 64};
+	index_to_polynomial(indicesa, 2, a, 2);
+	uint64_t expected_inva[2];
+	uint64_t indicesinva[3] = {61, 125, 126};
+	index_to_polynomial(indicesinva, 3, expected_inva, 2);
+	uint64_t inva[2];
+	
+	//Act
+	inv_itoh_tsujii(a, inva);
+	
+	//Assert
+	bool correct = equal_polynomials(inva, expected_inva, 2);
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_euclid_not_modifying_operands FAILED";
+	result.fail_msg = "inv_itoh_tsujii_case FAILED";
 	return result;
 }
 
-result_t inv_euclid_crossreference_extended_euclid() {
+result_t inv_itoh_tsujii_crossreference_inv_euclid() {
 	//Arrange
-	uint64_t a[2] = {68791025222456, 910257638};
-	uint64_t f[2];
-	uint64_t indicesf[3] = {0, 63, 127};
-	index_to_polynomial(indicesf, 3, f, 2);
-	uint64_t inva[2];
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t a[2];
+	uint64_t inva0[2];
+	uint64_t inva1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		rand_element(a);
+		
+		//Act
+		inv_itoh_tsujii(a, inva0);
+		inv_euclid(a, inva1);
+		
+		//Assert
+		correct = correct && equal_polynomials(inva0, inva1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_itoh_tsujii_crossreference_inv_euclid FAILED";
+	return result;
+}
+
+result_t inv_itoh_tsujii_one_and_zero() {
+	//Arrange
+	uint64_t one[2] = {1, 0};
+	uint64_t zero[2] = {0, 0};
+	uint64_t f[2] = {0x8000000000000001, 0x8000000000000000}; // Zero in the redundant representation
+	uint64_t inv_one[2];
+	uint64_t inv_zero[2];
+	uint64_t inv_f[2];
 	
 	//Act
-	inv_euclid(a, inva);
-	extended_euclid(a, f, gcd, g, h);
+	inv_itoh_tsujii(one, inv_one);
+	inv_itoh_tsujii(zero, inv_zero);
+	inv_itoh_tsujii(f, inv_f);
 	
 	//Assert
-	bool correct = equal_polynomials(inva, g, 2);
+	bool correct = equal_polynomials(inv_one, one, 2) && equal_polynomials(inv_zero, zero, 2)
+		&& equal_polynomials(inv_f, zero, 2);
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_euclid_crossreference_extended_euclid FAILED";
+	result.fail_msg = "inv_itoh_tsujii_one_and_zero FAILED";
 	return result;
 }
 
-result_t inv_euclid_product_of_inverses_is_inverse_of_product() {
+result_t inv_itoh_tsujii_product_is_one() {
 	//Arrange
-	uint64_t a[2] = {25846057920451, 2468420775};
-	uint64_t b[2] = {31148700972, 7201781698};
-	uint64_t ab[2];
+	uint64_t a[2];
 	uint64_t inva[2];
-	uint64_t invb[2];
-	uint64_t inva_times_invb[2];
 	uint64_t prod[2];
 	uint64_t one[2] = {1, 0};
+	rand_element(a);
+	a[1] |= 0x8000000000000000; // Redundant input
 	
 	//Act
-	mult_shiftadd(a, b, ab);
-	inv_euclid(a, inva);
-	inv_euclid(b, invb);
-	mult_shiftadd(inva, invb, inva_times_invb);
-	mult_shiftadd(ab, inva_times_invb, prod);
+	inv_itoh_tsujii(a, inva);
+	field_mul(a, inva, prod);
 	
 	//Assert
 	bool correct = equal_polynomials(prod, one, 2);
@@ -1650,20 +4287,46 @@ result_t inv_euclid_product_of_inverses_is_inverse_of_product() {
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_euclid_product_of_inverses_is_inverse_of_product FAILED";
+	result.fail_msg = "inv_itoh_tsujii_product_is_one FAILED";
 	return result;
 }
 
-void inv_euclid_correctness_tests() {
-	eval_test(inv_euclid_case());
-	eval_test(inv_euclid_not_modifying_operand());
-	eval_test(inv_euclid_crossreference_extended_euclid());
-	eval_test(inv_euclid_product_of_inverses_is_inverse_of_product());
+result_t inv_itoh_tsujii_table_agrees() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t inva0[2];
+	uint64_t inva1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		rand_element(a);
+		
+		//Act
+		inv_itoh_tsujii(a, inva0);
+		inv_itoh_tsujii_table(a, inva1);
+		
+		//Assert
+		correct = correct && equal_polynomials(inva0, inva1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_itoh_tsujii_table_agrees FAILED";
+	return result;
 }
 
-/* =================== inv_binary ========================= */
+void inv_itoh_tsujii_correctness_tests() {
+	eval_test(inv_itoh_tsujii_case());
+	eval_test(inv_itoh_tsujii_crossreference_inv_euclid());
+	eval_test(inv_itoh_tsujii_one_and_zero());
+	eval_test(inv_itoh_tsujii_product_is_one());
+	eval_test(inv_itoh_tsujii_table_agrees());
+}
 
-result_t inv_binary_case() {
+/* ======================= inv_safegcd ============================== */
+
+result_t inv_safegcd_case() {
 	//Arrange
 	uint64_t a[2];
 	uint64_t indicesa[2] = {1, 64};
@@ -1674,7 +4337,7 @@ result_t inv_binary_case() {
 	uint64_t inva[2];
 	
 	//Act
-	inv_binary(a, inva);
+	inv_safegcd(a, inva);
 	
 	//Assert
 	bool correct = equal_polynomials(inva, expected_inva, 2);
@@ -1682,108 +4345,500 @@ result_t inv_binary_case() {
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_binary_case FAILED";
+	result.fail_msg = "inv_safegcd_case FAILED";
 	return result;
 }
 
-result_t inv_binary_not_modifying_operand() {
+result_t inv_safegcd_crossreference_inv_itoh_tsujii() {
 	//Arrange
-	uint64_t a0[2] = {711032552186, 801382846842977};
-	uint64_t a1[2] = {711032552186, 801382846842977};
-	uint64_t inva[2];
+	uint64_t a[2];
+	uint64_t inva0[2];
+	uint64_t inva1[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 200; i++) {
+		rand_element(a);
+		
+		//Act
+		inv_safegcd(a, inva0);
+		inv_itoh_tsujii(a, inva1);
+		
+		//Assert
+		correct = correct && equal_polynomials(inva0, inva1, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_safegcd_crossreference_inv_itoh_tsujii FAILED";
+	return result;
+}
+
+result_t inv_safegcd_edge_cases() {
+	//Arrange
+	uint64_t one[2] = {1, 0};
+	uint64_t zero[2] = {0, 0};
+	uint64_t f[2] = {0x8000000000000001, 0x8000000000000000}; // Zero in the redundant representation
+	uint64_t top[2] = {0, 0x4000000000000000}; // z^126
+	uint64_t inv_one[2];
+	uint64_t inv_zero[2];
+	uint64_t inv_f[2];
+	uint64_t inv_top[2];
+	uint64_t prod[2];
 	
 	//Act
-	inv_binary(a1, inva);
+	inv_safegcd(one, inv_one);
+	inv_safegcd(zero, inv_zero);
+	inv_safegcd(f, inv_f);
+	inv_safegcd(top, inv_top);
+	field_mul(top, inv_top, prod);
 	
 	//Assert
-	bool correct = equal_polynomials(a0, a1, 2);
+	bool correct = equal_polynomials(inv_one, one, 2) && equal_polynomials(inv_zero, zero, 2)
+		&& equal_polynomials(inv_f, zero, 2) && equal_polynomials(prod, one, 2);
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_binary_not_modifying_operand FAILED";
+	result.fail_msg = "inv_safegcd_edge_cases FAILED";
 	return result;
 }
 
-result_t inv_binary_crossreference_extended_euclid() {
+result_t inv_safegcd_transform_kernels_agree() {
 	//Arrange
-	uint64_t a[2] = {5489300711, 9782012354};
-	uint64_t f[2];
-	uint64_t indicesf[3] = {0, 63, 127};
-	index_to_polynomial(indicesf, 3, f, 2);
-	uint64_t inva[2];
-	uint64_t gcd[2];
-	uint64_t g[2];
-	uint64_t h[2];
+	uint64_t m[4];
+	uint64_t x[2];
+	uint64_t y[2];
+	uint64_t p0[3], t0[3];
+	uint64_t p1[3], t1[3];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		rand_element(x);
+		rand_element(y);
+		rand_element(m);
+		rand_element(&m[2]);
+		for(int j = 0; j < 4; j++) {
+			m[j] >>= 1;
+		}
+		
+		//Act
+		safegcd_transform_software(m, x, y, p1, t1);
+		memcpy(p0, p1, sizeof(p1));
+		memcpy(t0, t1, sizeof(t1));
+		if(cpu_supports_pclmul()) {
+			safegcd_transform_clmul(m, x, y, p0, t0);
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(p0, p1, 3) && equal_polynomials(t0, t1, 3);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_safegcd_transform_kernels_agree FAILED";
+	return result;
+}
+
+void inv_safegcd_correctness_tests() {
+	eval_test(inv_safegcd_case());
+	eval_test(inv_safegcd_crossreference_inv_itoh_tsujii());
+	eval_test(inv_safegcd_edge_cases());
+	eval_test(inv_safegcd_transform_kernels_agree());
+}
+
+/* ======================= batch_invert ============================== */
+
+result_t batch_invert_crossreference_inv_euclid() {
+	//Arrange
+	uint64_t n = 37;
+	uint64_t a[74];
+	uint64_t inva0[74];
+	uint64_t inva1[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
 	
 	//Act
-	inv_binary(a, inva);
-	extended_euclid(a, f, gcd, g, h);
+	uint64_t zeros = batch_invert(a, inva0, n);
 	
 	//Assert
-	bool correct = equal_polynomials(inva, g, 2);
+	bool correct = zeros == 0;
+	for(int i = 0; i < n; i++) {
+		inv_euclid(&a[2*i], inva1);
+		correct = correct && equal_polynomials(&inva0[2*i], inva1, 2);
+	}
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_binary_crossreference_extended_euclid FAILED";
+	result.fail_msg = "batch_invert_crossreference_inv_euclid FAILED";
 	return result;
 }
 
-result_t inv_binary_crossreference_inv_euclid() {
+result_t batch_invert_zero_elements_map_to_zero() {
 	//Arrange
-	uint64_t a[2] = {469820358228, 972302255};
+	uint64_t n = 10;
+	uint64_t a[20];
+	uint64_t inva0[20];
+	uint64_t inva1[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
+	a[0] = a[1] = 0;
+	a[10] = a[11] = 0;
+	a[18] = a[19] = 0;
+	
+	//Act
+	uint64_t zeros = batch_invert(a, inva0, n);
+	
+	//Assert
+	bool correct = zeros == 3;
+	for(int i = 0; i < n; i++) {
+		if(a[2*i] == 0 && a[2*i + 1] == 0) {
+			correct = correct && inva0[2*i] == 0 && inva0[2*i + 1] == 0;
+		} else {
+			inv_euclid(&a[2*i], inva1);
+			correct = correct && equal_polynomials(&inva0[2*i], inva1, 2);
+		}
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "batch_invert_zero_elements_map_to_zero FAILED";
+	return result;
+}
+
+result_t batch_invert_in_place_crosses_blocks() {
+	//Arrange
+	uint64_t n = 600;
+	uint64_t * a = malloc(2*n*sizeof(uint64_t));
+	uint64_t * inva0 = malloc(2*n*sizeof(uint64_t));
+	uint64_t * inva1 = malloc(2*n*sizeof(uint64_t));
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
+	a[2*300] = a[2*300 + 1] = 0;
+	memcpy(inva1, a, 2*n*sizeof(uint64_t));
+	
+	//Act
+	uint64_t zeros0 = batch_invert(a, inva0, n);
+	uint64_t zeros1 = batch_invert_in_place(inva1, n);
+	
+	//Assert
+	bool correct = zeros0 == 1 && zeros1 == 1 && equal_polynomials(inva0, inva1, 2*n);
+	free(a);
+	free(inva0);
+	free(inva1);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "batch_invert_in_place_crosses_blocks FAILED";
+	return result;
+}
+
+result_t batch_invert_single_and_all_zero() {
+	//Arrange
+	uint64_t a[2] = {2, 0};
 	uint64_t inva0[2];
 	uint64_t inva1[2];
+	uint64_t zero[4] = {0, 0, 0, 0};
+	uint64_t invzero[4] = {5, 5, 5, 5};
 	
 	//Act
-	inv_binary(a, inva0);
+	uint64_t zeros_single = batch_invert(a, inva0, 1);
 	inv_euclid(a, inva1);
+	uint64_t zeros_all = batch_invert(zero, invzero, 2);
 	
 	//Assert
-	bool correct = equal_polynomials(inva0, inva1, 2);
+	bool correct = zeros_single == 0 && equal_polynomials(inva0, inva1, 2)
+		&& zeros_all == 2 && equal_polynomials(invzero, zero, 4);
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_binary_crossreference_inv_euclid FAILED";
+	result.fail_msg = "batch_invert_single_and_all_zero FAILED";
 	return result;
 }
 
-result_t inv_binary_product_of_inverses_is_inverse_of_product() {
+void batch_invert_correctness_tests() {
+	eval_test(batch_invert_crossreference_inv_euclid());
+	eval_test(batch_invert_zero_elements_map_to_zero());
+	eval_test(batch_invert_in_place_crosses_blocks());
+	eval_test(batch_invert_single_and_all_zero());
+}
+
+/* ======================= inv_array ============================== */
+
+result_t inv_array_crossreference_inv_itoh_tsujii() {
 	//Arrange
-	uint64_t a[2] = {3790115856821, 403885642179};
-	uint64_t b[2] = {617459943, 942720364782};
-	uint64_t ab[2];
-	uint64_t inva[2];
-	uint64_t invb[2];
-	uint64_t inva_times_invb[2];
-	uint64_t prod[2];
-	uint64_t one[2] = {1, 0};
+	uint64_t n = 37;
+	uint64_t a[74];
+	uint64_t inva0[74];
+	uint64_t inva1[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
+	a[6] = a[7] = 0;
+	a[40] = a[41] = 0;
+	a[72] = 0x8000000000000001; // Zero in the redundant representation
+	a[73] = 0x8000000000000000;
+	a[11] |= 0x8000000000000000;
+	bool correct = 1;
 	
 	//Act
-	mult_shiftadd(a, b, ab);
-	inv_binary(a, inva);
-	inv_binary(b, invb);
-	mult_shiftadd(inva, invb, inva_times_invb);
-	mult_shiftadd(ab, inva_times_invb, prod);
+	inv_array(a, inva0, n);
 	
 	//Assert
-	bool correct = equal_polynomials(prod, one, 2);
+	for(int i = 0; i < n; i++) {
+		inv_itoh_tsujii(&a[2*i], inva1);
+		correct = correct && equal_polynomials(&inva0[2*i], inva1, 2);
+	}
 	
 	//Return
 	result_t result;
 	result.success = correct;
-	result.fail_msg = "inv_binary_product_of_inverses_is_inverse_of_product FAILED";
+	result.fail_msg = "inv_array_crossreference_inv_itoh_tsujii FAILED";
 	return result;
 }
 
-void inv_binary_correctness_tests() {
-	eval_test(inv_binary_case());
-	eval_test(inv_binary_not_modifying_operand());
-	eval_test(inv_binary_crossreference_extended_euclid());
-	eval_test(inv_binary_crossreference_inv_euclid());
-	eval_test(inv_binary_product_of_inverses_is_inverse_of_product());
+result_t inv_array_kernels_agree() {
+	//Arrange
+	bool correct = 1;
+	for(uint64_t n = 1; n <= 19; n++) {
+		uint64_t a[38];
+		uint64_t c0[38];
+		uint64_t c1[38];
+		uint64_t c2[38];
+		for(int i = 0; i < n; i++) {
+			rand_element(&a[2*i]);
+		}
+		
+		//Act
+		inv_array_generic(a, c0, n);
+		memcpy(c1, c0, sizeof(c0));
+		memcpy(c2, c0, sizeof(c0));
+		if(cpu_supports_vpclmul()) {
+			inv_array_vpclmul(a, c1, n);
+		}
+		if(cpu_supports_vpclmul_avx2()) {
+			inv_array_vpclmul_avx2(a, c2, n);
+		}
+		
+		//Assert
+		correct = correct && equal_polynomials(c0, c1, 2*n) && equal_polynomials(c0, c2, 2*n);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_array_kernels_agree FAILED";
+	return result;
+}
+
+result_t inv_array_in_place() {
+	//Arrange
+	uint64_t n = 13;
+	uint64_t a[26];
+	uint64_t expected[26];
+	for(int i = 0; i < n; i++) {
+		rand_element(&a[2*i]);
+	}
+	inv_array_generic(a, expected, n);
+	
+	//Act
+	inv_array(a, a, n);
+	
+	//Assert
+	bool correct = equal_polynomials(a, expected, 2*n);
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "inv_array_in_place FAILED";
+	return result;
+}
+
+void inv_array_correctness_tests() {
+	eval_test(inv_array_crossreference_inv_itoh_tsujii());
+	eval_test(inv_array_kernels_agree());
+	eval_test(inv_array_in_place());
+}
+
+/* ======================= field_trace ============================== */
+
+/* Reference squaring, square_polynomial followed by reduction_generic */
+void square_reference(uint64_t * a, uint64_t * c) {
+	uint64_t sq[4];
+	square_polynomial(a, sq);
+	reduction_generic(sq);
+	c[0] = sq[0];
+	c[1] = sq[1];
+}
+
+/* sum of a^(2^(step*i)) for i = 0 ... terms - 1 */
+void sum_of_squarings_reference(uint64_t * a, int step, int terms, uint64_t * c) {
+	uint64_t t[2] = {a[0], a[1]};
+	c[0] = c[1] = 0;
+	for(int i = 0; i < terms; i++) {
+		c[0] ^= t[0];
+		c[1] ^= t[1];
+		for(int j = 0; j < step; j++) {
+			square_reference(t, t);
+		}
+	}
+}
+
+result_t field_trace_crossreference_squarings() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t tr[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		rand_element(a);
+		
+		//Act
+		uint64_t t = field_trace(a);
+		sum_of_squarings_reference(a, 1, 127, tr);
+		
+		//Assert
+		correct = correct && tr[1] == 0 && tr[0] == t;
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_trace_crossreference_squarings FAILED";
+	return result;
+}
+
+result_t field_trace_of_basis() {
+	//Arrange
+	bool correct = 1;
+	
+	for(int i = 0; i < 127; i++) {
+		uint64_t a[2] = {0, 0};
+		a[i / 64] = (uint64_t) 1 << (i % 64);
+		uint64_t tr[2];
+		
+		//Act
+		uint64_t t = field_trace(a);
+		sum_of_squarings_reference(a, 1, 127, tr);
+		
+		//Assert
+		correct = correct && t == tr[0] && t == (i == 0);
+	}
+	uint64_t redundant[2] = {0, 0x8000000000000000}; // z^127 = z^63 + 1
+	correct = correct && field_trace(redundant) == 1;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_trace_of_basis FAILED";
+	return result;
+}
+
+result_t field_halftrace_crossreference_squarings() {
+	//Arrange
+	uint64_t a[2];
+	uint64_t c[2];
+	uint64_t expected[2];
+	bool correct = 1;
+	
+	for(int i = 0; i < 20; i++) {
+		rand_element(a);
+		
+		//Act
+		field_halftrace(a, c);
+		sum_of_squarings_reference(a, 2, 64, expected);
+		
+		//Assert
+		correct = correct && equal_polynomials(c, expected, 2);
+	}
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_halftrace_crossreference_squarings FAILED";
+	return result;
+}
+
+result_t field_solve_quadratic_solutions() {
+	//Arrange
+	uint64_t c[2];
+	uint64_t x[2];
+	uint64_t lhs[2];
+	int num_solvable = 0;
+	bool correct = 1;
+	
+	for(int i = 0; i < 100; i++) {
+		rand_element(c);
+		
+		//Act
+		bool solvable = field_solve_quadratic(c, x);
+		
+		//Assert
+		square_reference(x, lhs);
+		lhs[0] ^= x[0];
+		lhs[1] ^= x[1];
+		if(solvable) {
+			correct = correct && equal_polynomials(lhs, c, 2);
+			num_solvable++;
+		} else {
+			lhs[0] ^= 1; // x^2 + x = c + 1 when Tr(c) = 1
+			correct = correct && equal_polynomials(lhs, c, 2);
+		}
+	}
+	correct = correct && num_solvable > 20 && num_solvable < 80;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_solve_quadratic_solutions FAILED";
+	return result;
+}
+
+result_t field_solve_quadratic_batch_crossreference() {
+	//Arrange
+	uint64_t n = 33;
+	uint64_t c[66];
+	uint64_t x[66];
+	bool solvable[33];
+	uint64_t expected_x[2];
+	for(int i = 0; i < n; i++) {
+		rand_element(&c[2*i]);
+	}
+	
+	//Act
+	uint64_t num_solvable = field_solve_quadratic_batch(c, x, solvable, n);
+	
+	//Assert
+	bool correct = 1;
+	uint64_t expected_num = 0;
+	for(int i = 0; i < n; i++) {
+		bool expected_solvable = field_solve_quadratic(&c[2*i], expected_x);
+		expected_num += expected_solvable;
+		correct = correct && solvable[i] == expected_solvable && equal_polynomials(&x[2*i], expected_x, 2);
+	}
+	correct = correct && num_solvable == expected_num;
+	
+	//Return
+	result_t result;
+	result.success = correct;
+	result.fail_msg = "field_solve_quadratic_batch_crossreference FAILED";
+	return result;
+}
+
+void field_trace_correctness_tests() {
+	eval_test(field_trace_crossreference_squarings());
+	eval_test(field_trace_of_basis());
+	eval_test(field_halftrace_crossreference_squarings());
+	eval_test(field_solve_quadratic_solutions());
+	eval_test(field_solve_quadratic_batch_crossreference());
 }
 
 void run_tests() {
@@ -1792,11 +4847,34 @@ void run_tests() {
 	add_correctness_tests();
 	mult_shiftadd_correctness_tests();
 	reduction_generic_correctness_tests();
+	reduction_trinomial_correctness_tests();
 	square_polynomial_correctness_tests();
 	mult_polynomial_rlcomb_correctness_tests();
 	mult_polynomial_lrcomb_correctness_tests();
+	mult_polynomial_lrcomb_window_correctness_tests();
 	mult_polynomial_lrcomb_window8_correctness_tests();
+	mult_polynomial_prepared_correctness_tests();
+	mult_karatsuba_correctness_tests();
+	mult_polynomial_holes_correctness_tests();
+	mult_polynomial_clmul_correctness_tests();
+	field_mul_correctness_tests();
+	mult_sparse_correctness_tests();
+	mult_batch_correctness_tests();
+	field_square_correctness_tests();
+	field_multisquare_correctness_tests();
+	field_sqrt_correctness_tests();
+	field_lazy_correctness_tests();
+	field_ctx_correctness_tests();
+	mult_bitsliced64_correctness_tests();
+	accumulator_correctness_tests();
 	extended_euclid_correctness_tests();
 	inv_euclid_correctness_tests();
 	inv_binary_correctness_tests();
+	inv_almost_inverse_correctness_tests();
+	field_div_correctness_tests();
+	inv_itoh_tsujii_correctness_tests();
+	inv_safegcd_correctness_tests();
+	batch_invert_correctness_tests();
+	inv_array_correctness_tests();
+	field_trace_correctness_tests();
 }
\ No newline at end of file
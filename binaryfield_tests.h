@@ -20,16 +20,62 @@ void mult_shiftadd_correctness_tests();
 
 void reduction_generic_correctness_tests();
 
+void reduction_trinomial_correctness_tests();
+
 void square_polynomial_correctness_tests();
 
 void mult_polynomial_rlcomb_correctness_tests();
 
 void mult_polynomial_lrcomb_correctness_tests();
 
+void mult_polynomial_lrcomb_window_correctness_tests();
+
 void mult_polynomial_lrcomb_window8_correctness_tests();
 
+void mult_polynomial_prepared_correctness_tests();
+
+void mult_karatsuba_correctness_tests();
+
+void mult_polynomial_holes_correctness_tests();
+
+void mult_polynomial_clmul_correctness_tests();
+
+void field_mul_correctness_tests();
+
+void mult_sparse_correctness_tests();
+
+void mult_batch_correctness_tests();
+
+void field_square_correctness_tests();
+
+void field_multisquare_correctness_tests();
+
+void field_sqrt_correctness_tests();
+
+void field_lazy_correctness_tests();
+
+void field_ctx_correctness_tests();
+
+void mult_bitsliced64_correctness_tests();
+
+void accumulator_correctness_tests();
+
 void extended_euclid_correctness_tests();
 
 void inv_euclid_correctness_tests();
 	
-void inv_binary_correctness_tests();
\ No newline at end of file
+void inv_binary_correctness_tests();
+
+void inv_almost_inverse_correctness_tests();
+
+void field_div_correctness_tests();
+
+void inv_itoh_tsujii_correctness_tests();
+
+void inv_safegcd_correctness_tests();
+
+void batch_invert_correctness_tests();
+
+void inv_array_correctness_tests();
+
+void field_trace_correctness_tests();
\ No newline at end of file